@@ -1,19 +1,30 @@
 @vs texture_vs
+uniform vs_params {
+    vec4 transform_x;
+    vec4 transform_y;
+};
+
 in vec2 position;
 in vec2 texcoord;
 in vec4 color;
+in float depth;
 
 out vec2 uv;
 out vec4 col;
 
 void main() {
-    gl_Position = vec4(position.x, position.y, 0.0, 1.0);
+    vec3 p = vec3(position, 1.0);
+    gl_Position = vec4(dot(transform_x.xyz, p), dot(transform_y.xyz, p), depth, 1.0);
     uv = texcoord;
     col = color;
 }
 @end
 
 @fs texture_fs
+uniform fs_params {
+    float alpha_cutoff;
+};
+
 uniform sampler2D tex;
 in vec2 uv;
 in vec4 col;
@@ -21,8 +32,102 @@ in vec4 col;
 out vec4 fragColor;
 
 void main() {
-    fragColor = texture(tex, uv) * col;
+    vec4 c = texture(tex, uv);
+    // Cut out batches write depth, so their transparent texels are dropped
+    // rather than hiding anything drawn behind them later. 0 keeps them all
+    if (c.a < alpha_cutoff)
+        discard;
+    fragColor = c * col;
+}
+@end
+
+@vs sprite_vs
+uniform vs_params {
+    vec4 transform_x;
+    vec4 transform_y;
+};
+
+in vec2 corner;
+in vec4 rect;
+in vec4 clip;
+in vec4 color;
+in float rotation;
+in float depth;
+
+out vec2 uv;
+out vec4 col;
+
+void main() {
+    vec2 size = rect.zw;
+    vec2 offset = (corner - 0.5) * size;
+    float s = sin(rotation);
+    float c = cos(rotation);
+    vec3 p = vec3(rect.xy + size * 0.5 + vec2(offset.x * c - offset.y * s, offset.x * s + offset.y * c), 1.0);
+    gl_Position = vec4(dot(transform_x.xyz, p), dot(transform_y.xyz, p), depth, 1.0);
+    uv = mix(clip.xy, clip.zw, corner);
+    col = color;
+}
+@end
+
+@vs multi_vs
+uniform vs_params {
+    vec4 transform_x;
+    vec4 transform_y;
+};
+
+in vec2 position;
+in vec2 texcoord;
+in vec4 color;
+in float slot;
+in float depth;
+
+out vec2 uv;
+out vec4 col;
+flat out float tex_index;
+
+void main() {
+    vec3 p = vec3(position, 1.0);
+    gl_Position = vec4(dot(transform_x.xyz, p), dot(transform_y.xyz, p), depth, 1.0);
+    uv = texcoord;
+    col = color;
+    tex_index = slot;
+}
+@end
+
+@fs multi_fs
+uniform fs_params {
+    float alpha_cutoff;
+};
+
+uniform sampler2D tex0;
+uniform sampler2D tex1;
+uniform sampler2D tex2;
+uniform sampler2D tex3;
+in vec2 uv;
+in vec4 col;
+flat in float tex_index;
+
+out vec4 fragColor;
+
+void main() {
+    // Gradients are taken before branching so every slot samples the same way
+    vec2 dx = dFdx(uv);
+    vec2 dy = dFdy(uv);
+    vec4 c;
+    if (tex_index < 0.5)
+        c = textureGrad(tex0, uv, dx, dy);
+    else if (tex_index < 1.5)
+        c = textureGrad(tex1, uv, dx, dy);
+    else if (tex_index < 2.5)
+        c = textureGrad(tex2, uv, dx, dy);
+    else
+        c = textureGrad(tex3, uv, dx, dy);
+    if (c.a < alpha_cutoff)
+        discard;
+    fragColor = c * col;
 }
 @end
 
 @program texture_program texture_vs texture_fs
+@program sprite_program sprite_vs texture_fs
+@program multi_program multi_vs multi_fs
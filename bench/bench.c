@@ -0,0 +1,276 @@
+//
+//  bench.c
+//  miso
+//
+//  Times the hot paths of the renderer over a number of frames and prints
+//  the averages. Run it from the repo root so assets/ can be found.
+//  miso.c is built into the same translation unit, so baselines can keep
+//  old code paths around using the renderer's internals.
+//
+
+#include "miso.c"
+// miso.c leaves the entry point to its host, here that's sokol_app
+#undef SOKOL_NO_ENTRY
+#include "sokol_app.h"
+#include "sokol_glue.h"
+#include <stdio.h>
+#if defined(MISO_WINDOWS)
+#include <windows.h>
+#endif
+
+#if !defined(BENCH_FRAMES)
+#define BENCH_FRAMES 120
+#endif
+#if !defined(BENCH_FLUSH_QUADS)
+#define BENCH_FLUSH_QUADS 65536
+#endif
+#if !defined(BENCH_SPRITES)
+#define BENCH_SPRITES 100000
+#endif
+#if !defined(BENCH_IMMEDIATE_DRAWS)
+#define BENCH_IMMEDIATE_DRAWS 10000
+#endif
+#if !defined(BENCH_CHUNK_SIZE)
+#define BENCH_CHUNK_SIZE 256
+#endif
+
+// Every benchmark draws from the same array of sprites
+_Static_assert(BENCH_SPRITES >= BENCH_FLUSH_QUADS && BENCH_SPRITES >= BENCH_IMMEDIATE_DRAWS, "BENCH_SPRITES is smaller than another benchmark's sprite count");
+
+typedef struct {
+    const char *name;
+    double total, best;
+    int count;
+} Timer;
+
+static struct {
+    MisoTexture *texture;
+    MisoTextureBatch *emptyBatch, *fullBatch, *spriteBatch;
+    MisoSprite *sprites;
+    MisoChunk *chunk;
+    MisoCamera camera;
+    int frame;
+    Timer flushEmpty, flushFull;
+    Timer spritesScalar, spritesBatched;
+    Timer immediateSubmit, immediateFlush, immediateBaseline;
+    Timer chunkDraw;
+} app;
+
+static double Now(void) {
+#if defined(MISO_WINDOWS)
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+#endif
+}
+
+static void Record(Timer *timer, double start) {
+    double elapsed = Now() - start;
+    if (!timer->count || elapsed < timer->best)
+        timer->best = elapsed;
+    timer->total += elapsed;
+    timer->count++;
+}
+
+static void Report(Timer *timer, int items) {
+    // Averages include driver stalls, the best frame shows the steady state
+    double average = timer->total / timer->count;
+    printf("%-28s avg %9.3f ms  best %9.3f ms", timer->name, average * 1e3, timer->best * 1e3);
+    if (items)
+        printf("  %8.2f M/s", items / average * 1e-6);
+    printf("\n");
+}
+
+static MisoSprite BenchSprite(int i) {
+    // Spread over the window with a bit of everything GenerateQuad handles
+    return (MisoSprite) {
+        .position = {(i * 37) % sapp_width(), (i * 91) % sapp_height()},
+        .size = {32.f, 16.f},
+        .clip = {(i % 4) * 32.f, 0.f, 32.f, 16.f},
+        .rotation = i % 3 ? 0.f : (float)(i % 360),
+        .depth = MisoIsoDepth(i % 64, 0.f)
+    };
+}
+
+static void init(void) {
+    sg_desc desc = {
+        .context = sapp_sgcontext()
+    };
+    sg_setup(&desc);
+    OrderMiso();
+    app.texture = MisoLoadTextureFromFile("assets/default.png");
+
+    // Flushing should cost what was drawn, not what the batch can hold
+    app.emptyBatch = MisoMakeTextureBatch(&(MisoTextureBatchDesc) {
+        .texture = app.texture,
+        .maxQuads = BENCH_FLUSH_QUADS
+    });
+    app.fullBatch = MisoMakeTextureBatch(&(MisoTextureBatchDesc) {
+        .texture = app.texture,
+        .maxQuads = BENCH_FLUSH_QUADS
+    });
+    app.flushEmpty.name = "flush, 1 quad";
+    app.flushFull.name = "flush, full batch";
+
+    // One sprite at a time against the batched kernel
+    app.spriteBatch = MisoMakeTextureBatch(&(MisoTextureBatchDesc) {
+        .texture = app.texture,
+        .maxQuads = BENCH_SPRITES
+    });
+    app.sprites = malloc(BENCH_SPRITES * sizeof(MisoSprite));
+    for (int i = 0; i < BENCH_SPRITES; i++)
+        app.sprites[i] = BenchSprite(i);
+    app.spritesScalar.name = "sprites, one at a time";
+    app.spritesBatched.name = "sprites, batched";
+
+    // Immediate draws are staged, then streamed in one append
+    app.immediateSubmit.name = "MisoDrawTexture";
+    app.immediateFlush.name = "MisoFlush";
+    app.immediateBaseline.name = "MisoDrawTexture, no staging";
+
+    // Meshing every visible tile of a chunk from its templates
+    app.chunk = MisoEmptyChunk(app.texture, BENCH_CHUNK_SIZE, BENCH_CHUNK_SIZE, 32, 16);
+    for (int x = 0; x < BENCH_CHUNK_SIZE; x++)
+        for (int y = 0; y < BENCH_CHUNK_SIZE; y++)
+            MisoChunkSet(app.chunk, x, y, (x * 7 + y * 3) % 4);
+    app.camera = (MisoCamera) {
+        .position = {0.f, 0.f},
+        .zoom = .5f
+    };
+    app.chunkDraw.name = "MisoDrawChunk";
+}
+
+static void BenchFlush(MisoVec2 scale, MisoVec2 viewport) {
+    MisoTextureBatchDraw(app.emptyBatch, (MisoVec2){0.f, 0.f}, (MisoVec2){32.f, 16.f}, scale, viewport, 0.f, (MisoRect){0.f, 0.f, 32.f, 16.f});
+    double start = Now();
+    MisoFlushTextureBatch(app.emptyBatch);
+    Record(&app.flushEmpty, start);
+    MisoTextureBatchDrawSprites(app.fullBatch, app.sprites, BENCH_FLUSH_QUADS, scale, viewport);
+    start = Now();
+    MisoFlushTextureBatch(app.fullBatch);
+    Record(&app.flushFull, start);
+}
+
+static void BenchSprites(MisoVec2 scale, MisoVec2 viewport) {
+    // Only generation is timed, the batch is rewound instead of drawn
+    double start = Now();
+    for (int i = 0; i < BENCH_SPRITES; i++) {
+        MisoSprite *s = &app.sprites[i];
+        MisoTextureBatchDraw(app.spriteBatch, s->position, s->size, scale, viewport, s->rotation, s->clip);
+    }
+    Record(&app.spritesScalar, start);
+    app.spriteBatch->vertexCount = 0;
+    start = Now();
+    MisoTextureBatchDrawSprites(app.spriteBatch, app.sprites, BENCH_SPRITES, scale, viewport);
+    Record(&app.spritesBatched, start);
+    app.spriteBatch->vertexCount = 0;
+}
+
+static void DrawTextureBaseline(MisoTexture *texture, MisoVec2 position, MisoVec2 size, MisoVec2 scale, MisoVec2 viewport, float rotation, MisoRect clip) {
+    // MisoDrawTexture before it was staged, a vertex buffer is made, drawn
+    // and destroyed for every call
+    Quad quad;
+    GenerateQuad(QuadViewport(scale, viewport), position, (MisoVec2){texture->w, texture->h}, size, rotation, clip, 0.f, &quad);
+    sg_buffer_desc desc = {
+        .data = SG_RANGE(quad)
+    };
+    sg_bindings bind = {
+        .vertex_buffers[0] = sg_make_buffer(&desc),
+        .index_buffer = state.quad_indices,
+        .fs_images[SLOT_tex] = texture->sg
+    };
+    ApplyTexturePipeline(MISO_VERTEX_DEFAULT, SG_INDEXTYPE_UINT16, 0.f);
+    sg_apply_bindings(&bind);
+    ApplyTransform(&IdentityTransform);
+    sg_draw(0, 6, 1);
+    sg_destroy_buffer(bind.vertex_buffers[0]);
+}
+
+static void BenchImmediate(MisoVec2 scale, MisoVec2 viewport) {
+    double start = Now();
+    for (int i = 0; i < BENCH_IMMEDIATE_DRAWS; i++) {
+        MisoSprite *s = &app.sprites[i];
+        MisoDrawTexture(app.texture, s->position, s->size, scale, viewport, s->rotation, s->clip);
+    }
+    Record(&app.immediateSubmit, start);
+    start = Now();
+    MisoFlush();
+    Record(&app.immediateFlush, start);
+}
+
+static void BenchImmediateBaseline(MisoVec2 scale, MisoVec2 viewport) {
+    double start = Now();
+    for (int i = 0; i < BENCH_IMMEDIATE_DRAWS; i++) {
+        MisoSprite *s = &app.sprites[i];
+        DrawTextureBaseline(app.texture, s->position, s->size, scale, viewport, s->rotation, s->clip);
+    }
+    Record(&app.immediateBaseline, start);
+}
+
+static void BenchChunk(MisoVec2 scale, MisoVec2 viewport) {
+    (void)scale;
+    (void)viewport;
+    double start = Now();
+    MisoDrawChunk(app.chunk, &app.camera);
+    Record(&app.chunkDraw, start);
+}
+
+static void(*benches[])(MisoVec2, MisoVec2) = {
+    BenchFlush,
+    BenchSprites,
+    BenchImmediate,
+    BenchImmediateBaseline,
+    BenchChunk
+};
+
+static void frame(void) {
+    // Each benchmark gets frames of its own, so it never waits on GPU work
+    // queued by another one
+    int bench = app.frame++ / BENCH_FRAMES;
+    if (bench == sizeof(benches) / sizeof(benches[0])) {
+        printf("%d frames each at %dx%d\n", BENCH_FRAMES, sapp_width(), sapp_height());
+        Report(&app.flushEmpty, 0);
+        Report(&app.flushFull, BENCH_FLUSH_QUADS);
+        Report(&app.spritesScalar, BENCH_SPRITES);
+        Report(&app.spritesBatched, BENCH_SPRITES);
+        Report(&app.immediateSubmit, BENCH_IMMEDIATE_DRAWS);
+        Report(&app.immediateFlush, BENCH_IMMEDIATE_DRAWS);
+        Report(&app.immediateBaseline, BENCH_IMMEDIATE_DRAWS);
+        Report(&app.chunkDraw, app.chunk->emittedTiles);
+        sapp_request_quit();
+        return;
+    }
+    OrderUp(sapp_width(), sapp_height());
+    benches[bench]((MisoVec2){1.f, 1.f}, (MisoVec2){sapp_width(), sapp_height()});
+    FinishMiso();
+    sg_commit();
+}
+
+static void cleanup(void) {
+    MisoDestroyChunk(app.chunk);
+    MisoDestroyTextureBatch(app.emptyBatch);
+    MisoDestroyTextureBatch(app.fullBatch);
+    MisoDestroyTextureBatch(app.spriteBatch);
+    MisoDestroyTexture(app.texture);
+    free(app.sprites);
+    CleanUpMiso();
+    sg_shutdown();
+}
+
+sapp_desc sokol_main(int argc, char* argv[]) {
+    (void)argc;
+    (void)argv;
+    return (sapp_desc){
+        .init_cb = init,
+        .frame_cb = frame,
+        .cleanup_cb = cleanup,
+        .width = 1280,
+        .height = 720,
+        .window_title = "miso bench"
+    };
+}
@@ -8,7 +8,6 @@
 
 #define LUA_IMPL
 #define LUACSTRUCT_IMPL
-#define HASHMAP_IMPL
 #include "ecs.h"
 #include <stdlib.h>
 #include <string.h>
@@ -78,7 +78,8 @@ typedef struct {
 static struct {
     sg_pass_action pass_action;
     MisoTexture *gridTexture, *mapTexture;
-    MisoChunk *grid, *map;
+    MisoChunk *map;
+    int gridLayer;
     MisoCamera camera;
     float cameraSpeed;
     float cameraScrollSpeed;
@@ -106,7 +107,7 @@ static void init(void) {
     };
     sg_setup(&desc);
     snk_desc_t snk_desc = {
-        .depth_format = SG_PIXELFORMAT_DEPTH,
+        .depth_format = SG_PIXELFORMAT_DEPTH_STENCIL,
         .color_format = SG_PIXELFORMAT_RGBA8
     };
     snk_setup(&snk_desc);
@@ -139,9 +140,12 @@ static void init(void) {
     };
     state.mapTexture = MisoLoadTextureFromFile("assets/default.png");
     state.map = MisoEmptyChunk(state.mapTexture, state.settings.mapWidth, state.settings.mapHeight, state.settings.tileWidth, state.settings.tileHeight);
+    MisoSetChunkStatic(state.map, true);
     state.gridTexture = MisoLoadTextureFromFile("assets/grid.png");
-    state.grid = MisoEmptyChunk(state.gridTexture, state.settings.mapWidth, state.settings.mapHeight, state.settings.tileWidth, state.settings.tileHeight);
-    MisoResizeTextureBatch(&state.grid->batch, (state.settings.mapWidth * state.settings.mapHeight) + 1);
+    state.gridLayer = MisoChunkAddLayer(state.map, state.gridTexture);
+    for (int x = 0; x < state.map->w; x++)
+        for (int y = 0; y < state.map->h; y++)
+            MisoChunkLayerSet(state.map, state.gridLayer, x, y, 0);
     
     MisoImage *font = MisoEmptyImage(128 * 8, 8);
     MisoColor white = {.rgba = 0xFFFFFFFF};
@@ -164,10 +168,6 @@ do {
     MisoDestroyImage(font);
 }
 
-static void DrawMapGrid(MisoChunk *chunk, MisoCamera *camera, MisoVec2 position, MisoVec2 gridPosition) {
-    MisoTextureBatchDraw(chunk->batch, (MisoVec2){position.x - (chunk->tileW / 2), position.y - (chunk->tileH / 2)}, (MisoVec2){chunk->tileW, chunk->tileH}, (MisoVec2){camera->zoom, camera->zoom}, (MisoVec2){sapp_width(), sapp_height()}, 0.f, (MisoRect){0, 0, chunk->tileW, chunk->tileH});
-}
-
 void DbgDrawString(int x, int y, const char *string) {
     int xoff = x, yoff = y + 25;
     for (int i = 0; i < strlen(string); i++) {
@@ -238,14 +238,20 @@ static void frame(void) {
     
 
     OrderUp(sapp_width(), sapp_height());
+    state.mouseGridPos = MisoScreenToChunkTile(state.map, &state.camera, state.mousePos);
     MisoDrawChunk(state.map, &state.camera);
-    MisoDrawChunkCustom(state.grid, &state.camera, DrawMapGrid);
-    // TODO: World <-> Screen conversions need work, still not very accurate
-    MisoVec2 mouseGridPosition = MisoChunkTileToScreen(state.grid, &state.camera, state.mouseGridPos);
-    MisoTextureBatchDraw(state.grid->batch, (MisoVec2){mouseGridPosition.x - (state.grid->tileW / 2), mouseGridPosition.y - (state.grid->tileH / 2)}, (MisoVec2){state.grid->tileW, state.grid->tileH}, (MisoVec2){state.camera.zoom, state.camera.zoom}, (MisoVec2){sapp_width(), sapp_height()}, 0.f, (MisoRect){state.grid->tileW, 0, state.grid->tileW, state.grid->tileH});
-    MisoFlushTextureBatch(state.grid->batch);
-    DbgDrawString(0, 0, "Hello, world!");
+    // The cursor is drawn over the map rather than stored in it, so moving it
+    // doesn't invalidate the map's baked geometry
+    int mouseX = (int)state.mouseGridPos.x, mouseY = (int)state.mouseGridPos.y;
+    if (mouseX >= 0 && mouseX < state.map->w && mouseY >= 0 && mouseY < state.map->h) {
+        MisoVec2 cursor = MisoChunkTileToScreen(state.map, &state.camera, state.mouseGridPos);
+        MisoVec2 size = {state.map->tileW * state.camera.zoom, state.map->tileH * state.camera.zoom};
+        MisoDrawTexture(state.gridTexture, (MisoVec2){cursor.x - size.x / 2.f, cursor.y - size.y / 2.f}, size, (MisoVec2){1.f, 1.f}, (MisoVec2){sapp_width(), sapp_height()}, 0.f, (MisoRect){state.map->tileW, 0, state.map->tileW, state.map->tileH});
+    }
+    DbgDrawStringFormat(0, 0, "tiles: %d drawn, %d culled", state.map->emittedTiles, state.map->culledTiles);
     MisoFlushTextureBatch(state.fontBatch);
+    // The cursor is only staged so far, it has to be drawn before the UI
+    MisoFlush();
     snk_render(sapp_width(), sapp_height());
     FinishMiso();
     
@@ -276,7 +282,6 @@ static void event(const sapp_event *e) {
             break;
         case SAPP_EVENTTYPE_MOUSE_MOVE:
             state.mousePos = (MisoVec2){e->mouse_x, e->mouse_y};
-            state.mouseGridPos = MisoScreenToChunkTile(state.map, &state.camera, state.mousePos);
             break;
         default:
             break;
@@ -287,7 +292,6 @@ static void cleanup(void) {
     MisoDestroyTexture(state.mapTexture);
     MisoDestroyTexture(state.gridTexture);
     MisoDestroyChunk(state.map);
-    MisoDestroyChunk(state.grid);
     MisoDestroyTexture(state.fontTexture);
     MisoDestroyTextureBatch(state.fontBatch);
     CleanUpMiso();
@@ -9,13 +9,31 @@
 #define SOKOL_NO_ENTRY
 #define STB_IMAGE_IMPLEMENTATION
 #define QOI_IMPLEMENTATION
+#define HASHMAP_IMPL
 #include "miso.h"
+#include "hashmap.h"
 
 static struct {
     bool initialized, inProgress;
+    unsigned int frame;
     sg_pass_action pass_action;
-    sg_pipeline offscreen_pip;
+    sg_pipeline offscreen_pip[MISO_VERTEX_FORMAT_COUNT][2][2];
+    sg_buffer quad_indices, quad_corners;
+    sg_buffer *transient, transientIndices;
+    int transientCount, transientIndex;
+    MisoVertex *immediate;
+    MisoRenderRun *immediateRuns;
+    int immediateCount, immediateRunCount;
+    float immediateCutoff;
     MisoVec2 size;
+    MisoVec2 quadScale, quadViewportSize;
+    MisoTransform quadViewport;
+    sg_pass lodPass;
+    sg_pipeline lodPipeline;
+    MisoTexture lodTexture;
+    unsigned int lodGeneration, lodResetFrame;
+    int lodShelfX, lodShelfY, lodShelfH;
+    bool baking;
 #if !defined(MISO_DISABLE_FRAMEBUFFER)
     sg_pass pass;
     sg_pipeline framebuffer_pip;
@@ -28,54 +46,242 @@ static struct {
     }
 };
 
-MisoChunk* MisoEmptyChunk(MisoTexture *texture, int w, int h, int tileW, int tileH) {
-    assert(!(w % tileH));
-    MisoChunk *result = malloc(sizeof(MisoChunk));
-    result->batch = MisoCreateTextureBatch(texture, w * h);
-    size_t sz = w * h * sizeof(int);
-    result->grid = malloc(sz);
-    memset(result->grid, 0, sz);
-    result->w = w;
-    result->h = h;
-    result->tileW = tileW;
-    result->tileH = tileH;
+#if !defined(MIN)
+#define MIN(A, B) ((A) < (B) ? (A) : (B))
+#endif
+#if !defined(MAX)
+#define MAX(A, B) ((A) > (B) ? (A) : (B))
+#endif
+
+#if !defined(MISO_DISABLE_SIMD)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define MISO_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define MISO_NEON
+#endif
+#endif
+
+#if defined(MISO_EMSCRIPTEN) && !defined(__EMSCRIPTEN_PTHREADS__) && !defined(MISO_DISABLE_JOBS)
+#define MISO_DISABLE_JOBS
+#endif
+
+#if !defined(MISO_MAX_WORKERS)
+#define MISO_MAX_WORKERS 15
+#endif
+
+#if !defined(MISO_DISABLE_JOBS)
+#if defined(MISO_WINDOWS) && !defined(MISO_POSIX)
+#include <windows.h>
+typedef HANDLE JobThread;
+typedef CRITICAL_SECTION JobMutex;
+typedef CONDITION_VARIABLE JobCond;
+#define JobMutexInit(M) InitializeCriticalSection(M)
+#define JobMutexDestroy(M) DeleteCriticalSection(M)
+#define JobLock(M) EnterCriticalSection(M)
+#define JobUnlock(M) LeaveCriticalSection(M)
+#define JobCondInit(C) InitializeConditionVariable(C)
+#define JobCondDestroy(C)
+#define JobWait(C, M) SleepConditionVariableCS(C, M, INFINITE)
+#define JobBroadcast(C) WakeAllConditionVariable(C)
+#else
+#include <pthread.h>
+#include <unistd.h>
+typedef pthread_t JobThread;
+typedef pthread_mutex_t JobMutex;
+typedef pthread_cond_t JobCond;
+#define JobMutexInit(M) pthread_mutex_init(M, NULL)
+#define JobMutexDestroy(M) pthread_mutex_destroy(M)
+#define JobLock(M) pthread_mutex_lock(M)
+#define JobUnlock(M) pthread_mutex_unlock(M)
+#define JobCondInit(C) pthread_cond_init(C, NULL)
+#define JobCondDestroy(C) pthread_cond_destroy(C)
+#define JobWait(C, M) pthread_cond_wait(C, M)
+#define JobBroadcast(C) pthread_cond_broadcast(C)
+#endif
+
+typedef struct {
+    JobMutex lock;
+    int begin, end;
+} JobRange;
+
+static struct {
+    JobThread threads[MISO_MAX_WORKERS];
+    // One range per worker, the thread calling MisoParallelFor takes the last
+    JobRange ranges[MISO_MAX_WORKERS + 1];
+    int workerCount;
+    JobMutex lock;
+    JobCond wake, done;
+    void(*func)(void*, int);
+    void *userdata;
+    unsigned int generation;
+    int busy;
+    bool quit, running;
+} jobs;
+
+static int PopJob(JobRange *range) {
+    int result = -1;
+    JobLock(&range->lock);
+    if (range->begin < range->end)
+        result = range->begin++;
+    JobUnlock(&range->lock);
     return result;
 }
 
-int MisoChunkAt(MisoChunk *chunk, int x, int y) {
-    assert(x >= 0 && x < chunk->w && y >= 0 && y < chunk->h);
-    return chunk->grid[y * chunk->w + x];
+static bool StealJobs(int self) {
+    // Take the top half of the first range that still has work left
+    int participants = jobs.workerCount + 1;
+    for (int i = 1; i < participants; i++) {
+        JobRange *victim = &jobs.ranges[(self + i) % participants];
+        JobLock(&victim->lock);
+        int left = victim->end - victim->begin;
+        if (left <= 0) {
+            JobUnlock(&victim->lock);
+            continue;
+        }
+        int begin = victim->end - (left + 1) / 2, end = victim->end;
+        victim->end = begin;
+        JobUnlock(&victim->lock);
+        JobLock(&jobs.ranges[self].lock);
+        jobs.ranges[self].begin = begin;
+        jobs.ranges[self].end = end;
+        JobUnlock(&jobs.ranges[self].lock);
+        return true;
+    }
+    return false;
 }
 
-void MisoChunkSet(MisoChunk *chunk, int x, int y, int value) {
-    assert(x >= 0 && x < chunk->w && y >= 0 && y < chunk->h);
-    assert(value < (chunk->w / chunk->tileH));
-    chunk->grid[y * chunk->w + x] = value;
+static void RunJobs(int self) {
+    for (;;) {
+        int index = PopJob(&jobs.ranges[self]);
+        if (index < 0) {
+            if (!StealJobs(self))
+                break;
+            continue;
+        }
+        jobs.func(jobs.userdata, index);
+    }
 }
 
-void MisoDrawChunkCustom(MisoChunk *chunk, MisoCamera *camera, void(*Callback)(MisoChunk*, MisoCamera*, MisoVec2, MisoVec2)) {
-    for (int x = 0; x < chunk->w; x++)
-        for (int y = 0; y < chunk->h; y++)
-            Callback(chunk, camera, MisoChunkTileToScreen(chunk, camera, (MisoVec2){x, y}), (MisoVec2){x, y});
+static void JobWorker(int self) {
+    unsigned int seen = 0;
+    for (;;) {
+        JobLock(&jobs.lock);
+        while (!jobs.quit && jobs.generation == seen)
+            JobWait(&jobs.wake, &jobs.lock);
+        if (jobs.quit) {
+            JobUnlock(&jobs.lock);
+            break;
+        }
+        seen = jobs.generation;
+        JobUnlock(&jobs.lock);
+        RunJobs(self);
+        JobLock(&jobs.lock);
+        if (!--jobs.busy)
+            JobBroadcast(&jobs.done);
+        JobUnlock(&jobs.lock);
+    }
 }
 
-static void DrawChunkDefault(MisoChunk *chunk, MisoCamera *camera, MisoVec2 position, MisoVec2 gridPosition) {
-    MisoTextureBatchDraw(chunk->batch, (MisoVec2){position.x - (chunk->tileW / 2), position.y - (chunk->tileH / 2)}, (MisoVec2){chunk->tileW, chunk->tileH}, (MisoVec2){camera->zoom, camera->zoom}, state.size, 0.f, (MisoRect){MisoChunkAt(chunk, gridPosition.x, gridPosition.y) * chunk->tileW, 0, chunk->tileW, chunk->tileH});
+#if defined(MISO_WINDOWS) && !defined(MISO_POSIX)
+static DWORD WINAPI JobThreadMain(LPVOID arg) {
+    JobWorker((int)(intptr_t)arg);
+    return 0;
 }
 
-void MisoDrawChunk(MisoChunk *chunk, MisoCamera *camera) {
-    MisoDrawChunkCustom(chunk, camera, DrawChunkDefault);
-    MisoFlushTextureBatch(chunk->batch);
+static int CoreCount(void) {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (int)info.dwNumberOfProcessors;
+}
+#else
+static void* JobThreadMain(void *arg) {
+    JobWorker((int)(intptr_t)arg);
+    return NULL;
 }
 
-void MisoDestroyChunk(MisoChunk *chunk) {
-    if (chunk) {
-        if (chunk->batch)
-            MisoDestroyTextureBatch(chunk->batch);
-        if (chunk->grid)
-            free(chunk->grid);
-        free(chunk);
+static int CoreCount(void) {
+    return (int)sysconf(_SC_NPROCESSORS_ONLN);
+}
+#endif
+
+static void StartJobs(void) {
+    // One worker per core besides the calling thread, MISO_JOB_WORKERS overrides it
+#if defined(MISO_JOB_WORKERS)
+    int count = MISO_JOB_WORKERS;
+#else
+    int count = CoreCount() - 1;
+#endif
+    jobs.workerCount = MAX(0, MIN(MISO_MAX_WORKERS, count));
+    jobs.generation = 0;
+    jobs.busy = 0;
+    jobs.quit = false;
+    jobs.running = false;
+    JobMutexInit(&jobs.lock);
+    JobCondInit(&jobs.wake);
+    JobCondInit(&jobs.done);
+    for (int i = 0; i <= jobs.workerCount; i++)
+        JobMutexInit(&jobs.ranges[i].lock);
+    for (int i = 0; i < jobs.workerCount; i++) {
+#if defined(MISO_WINDOWS) && !defined(MISO_POSIX)
+        jobs.threads[i] = CreateThread(NULL, 0, JobThreadMain, (LPVOID)(intptr_t)i, 0, NULL);
+#else
+        pthread_create(&jobs.threads[i], NULL, JobThreadMain, (void*)(intptr_t)i);
+#endif
+    }
+}
+
+static void StopJobs(void) {
+    JobLock(&jobs.lock);
+    jobs.quit = true;
+    JobBroadcast(&jobs.wake);
+    JobUnlock(&jobs.lock);
+    for (int i = 0; i < jobs.workerCount; i++) {
+#if defined(MISO_WINDOWS) && !defined(MISO_POSIX)
+        WaitForSingleObject(jobs.threads[i], INFINITE);
+        CloseHandle(jobs.threads[i]);
+#else
+        pthread_join(jobs.threads[i], NULL);
+#endif
+    }
+    for (int i = 0; i <= jobs.workerCount; i++)
+        JobMutexDestroy(&jobs.ranges[i].lock);
+    JobCondDestroy(&jobs.wake);
+    JobCondDestroy(&jobs.done);
+    JobMutexDestroy(&jobs.lock);
+    jobs.workerCount = 0;
+}
+#endif
+
+void MisoParallelFor(int count, void(*func)(void *userdata, int index), void *userdata) {
+#if !defined(MISO_DISABLE_JOBS)
+    // Nested calls, and calls before OrderMiso, run on the calling thread
+    if (jobs.workerCount && count > 1 && !jobs.running) {
+        int participants = jobs.workerCount + 1;
+        for (int i = 0; i < participants; i++) {
+            jobs.ranges[i].begin = (int)((long long)count * i / participants);
+            jobs.ranges[i].end = (int)((long long)count * (i + 1) / participants);
+        }
+        JobLock(&jobs.lock);
+        jobs.func = func;
+        jobs.userdata = userdata;
+        jobs.busy = jobs.workerCount;
+        jobs.running = true;
+        jobs.generation++;
+        JobBroadcast(&jobs.wake);
+        JobUnlock(&jobs.lock);
+        RunJobs(jobs.workerCount);
+        JobLock(&jobs.lock);
+        while (jobs.busy)
+            JobWait(&jobs.done, &jobs.lock);
+        jobs.running = false;
+        JobUnlock(&jobs.lock);
+        return;
     }
+#endif
+    for (int i = 0; i < count; i++)
+        func(userdata, i);
 }
 
 MisoImage* MisoEmptyImage(unsigned int w, unsigned int h) {
@@ -202,11 +408,50 @@ void MisoUpdateTexture(MisoTexture *texture, MisoImage *img) {
 #define ATTR_texture_vs_position (0)
 #define ATTR_texture_vs_texcoord (1)
 #define ATTR_texture_vs_color (2)
+#define ATTR_texture_vs_depth (3)
+#define ATTR_sprite_vs_corner (0)
+#define ATTR_sprite_vs_rect (1)
+#define ATTR_sprite_vs_clip (2)
+#define ATTR_sprite_vs_color (3)
+#define ATTR_sprite_vs_rotation (4)
+#define ATTR_sprite_vs_depth (5)
+#define ATTR_multi_vs_position (0)
+#define ATTR_multi_vs_texcoord (1)
+#define ATTR_multi_vs_color (2)
+#define ATTR_multi_vs_slot (3)
+#define ATTR_multi_vs_depth (4)
+#define SLOT_vs_params (0)
+#define SLOT_fs_params (0)
 #define SLOT_tex (0)
+#define SLOT_tex0 (0)
+#define SLOT_tex1 (1)
+#define SLOT_tex2 (2)
+#define SLOT_tex3 (3)
+#if !defined(SOKOL_SHDC_ALIGN)
+  #if defined(_MSC_VER)
+    #define SOKOL_SHDC_ALIGN(a) __declspec(align(a))
+  #else
+    #define SOKOL_SHDC_ALIGN(a) __attribute__((aligned(a)))
+  #endif
+#endif
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct vs_params_t {
+    float transform_x[4];
+    float transform_y[4];
+} vs_params_t;
+#pragma pack(pop)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct fs_params_t {
+    float alpha_cutoff;
+    uint8_t _pad_4[12];
+} fs_params_t;
+#pragma pack(pop)
 /*
     #version 330
     
+    uniform vec4 vs_params[2];
     layout(location = 0) in vec2 position;
+    layout(location = 3) in float depth;
     out vec2 uv;
     layout(location = 1) in vec2 texcoord;
     out vec4 col;
@@ -214,62 +459,92 @@ void MisoUpdateTexture(MisoTexture *texture, MisoImage *img) {
     
     void main()
     {
-        gl_Position = vec4(position.x, position.y, 0.0, 1.0);
+        vec3 _23 = vec3(position, 1.0);
+        gl_Position = vec4(dot(vs_params[0].xyz, _23), dot(vs_params[1].xyz, _23), depth, 1.0);
         uv = texcoord;
         col = color;
     }
     
 */
-static const char texture_vs_source_glsl330[268] = {
-    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0x0a,0x0a,0x6c,0x61,
-    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
-    0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x6f,0x73,0x69,0x74,
-    0x69,0x6f,0x6e,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,
+static const char texture_vs_source_glsl330[402] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x33,0x29,0x20,0x69,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x65,
+    0x70,0x74,0x68,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,
     0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
     0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x74,
     0x65,0x78,0x63,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,
     0x34,0x20,0x63,0x6f,0x6c,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
     0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,0x20,0x76,
     0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,
-    0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,
-    0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,
-    0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,0x78,0x2c,0x20,0x70,0x6f,0x73,
-    0x69,0x74,0x69,0x6f,0x6e,0x2e,0x79,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,
-    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x74,0x65,0x78,
-    0x63,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x20,0x3d,
-    0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+    0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x33,0x20,0x5f,0x32,0x33,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x76,0x65,0x63,0x34,0x28,0x64,0x6f,0x74,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x5f,0x32,0x33,0x29,0x2c,
+    0x20,0x64,0x6f,0x74,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,
+    0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x5f,0x32,0x33,0x29,0x2c,0x20,0x64,0x65,0x70,
+    0x74,0x68,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,
+    0x20,0x3d,0x20,0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x00,
 };
 /*
     #version 330
     
+    uniform vec4 fs_params[1];
     uniform sampler2D tex;
     
-    layout(location = 0) out vec4 fragColor;
     in vec2 uv;
+    layout(location = 0) out vec4 fragColor;
     in vec4 col;
     
     void main()
     {
-        fragColor = texture(tex, uv) * col;
+        vec4 _14 = texture(tex, uv);
+        if (_14.w < fs_params[0].x)
+        {
+            discard;
+        }
+        fragColor = _14 * col;
     }
     
 */
-static const char texture_fs_source_glsl330[163] = {
+static const char texture_fs_source_glsl330[271] = {
     0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0x0a,0x0a,0x75,0x6e,
-    0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,
-    0x74,0x65,0x78,0x3b,0x0a,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
-    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,
-    0x65,0x63,0x34,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x69,
-    0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x3b,0x0a,0x69,0x6e,0x20,0x76,0x65,
-    0x63,0x34,0x20,0x63,0x6f,0x6c,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,
-    0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x43,
-    0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x74,
-    0x65,0x78,0x2c,0x20,0x75,0x76,0x29,0x20,0x2a,0x20,0x63,0x6f,0x6c,0x3b,0x0a,0x7d,
-    0x0a,0x0a,0x00,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,
+    0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x74,0x65,0x78,0x3b,0x0a,
+    0x0a,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,
+    0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x72,0x61,0x67,0x43,
+    0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,
+    0x6c,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x31,0x34,0x20,0x3d,
+    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x74,0x65,0x78,0x2c,0x20,0x75,0x76,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x31,0x34,0x2e,0x77,
+    0x20,0x3c,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,
+    0x78,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,
+    0x5f,0x31,0x34,0x20,0x2a,0x20,0x63,0x6f,0x6c,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
 /*
+    cbuffer vs_params : register(b0)
+    {
+        float4 _19_transform_x : packoffset(c0);
+        float4 _19_transform_y : packoffset(c1);
+    };
+    
+    
     static float4 gl_Position;
     static float2 position;
+    static float depth;
     static float2 uv;
     static float2 texcoord;
     static float4 col;
@@ -280,6 +555,7 @@ static const char texture_fs_source_glsl330[163] = {
         float2 position : TEXCOORD0;
         float2 texcoord : TEXCOORD1;
         float4 color : TEXCOORD2;
+        float depth : TEXCOORD3;
     };
     
     struct SPIRV_Cross_Output
@@ -289,20 +565,23 @@ static const char texture_fs_source_glsl330[163] = {
         float4 gl_Position : SV_Position;
     };
     
-    #line 14 "assets/texture.glsl"
+    #line 16 "assets/texture.glsl"
     void vert_main()
     {
-    #line 14 "assets/texture.glsl"
-        gl_Position = float4(position.x, position.y, 0.0f, 1.0f);
-    #line 15 "assets/texture.glsl"
-        uv = texcoord;
     #line 16 "assets/texture.glsl"
+        float3 _23 = float3(position, 1.0f);
+    #line 17 "assets/texture.glsl"
+        gl_Position = float4(dot(_19_transform_x.xyz, _23), dot(_19_transform_y.xyz, _23), depth, 1.0f);
+    #line 18 "assets/texture.glsl"
+        uv = texcoord;
+    #line 19 "assets/texture.glsl"
         col = color;
     }
     
     SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
     {
         position = stage_input.position;
+        depth = stage_input.depth;
         texcoord = stage_input.texcoord;
         color = stage_input.color;
         vert_main();
@@ -313,75 +592,100 @@ static const char texture_fs_source_glsl330[163] = {
         return stage_output;
     }
 */
-static const char texture_vs_source_hlsl5[972] = {
-    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,
-    0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,
-    0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
-    0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
-    0x20,0x75,0x76,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x32,0x20,0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x73,0x74,0x61,
-    0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x3b,0x0a,
-    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,
-    0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,
-    0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,
-    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x6f,0x73,0x69,
-    0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,
-    0x63,0x6f,0x6f,0x72,0x64,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,
-    0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,
-    0x6c,0x6f,0x72,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x32,0x3b,
-    0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,
-    0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,
-    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x20,0x3a,
-    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,
-    0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,
-    0x20,0x53,0x56,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x7d,0x3b,
-    0x0a,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x31,0x34,0x20,0x22,0x61,0x73,0x73,0x65,
-    0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,
-    0x0a,0x76,0x6f,0x69,0x64,0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,0x28,
-    0x29,0x0a,0x7b,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x31,0x34,0x20,0x22,0x61,0x73,
-    0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,
-    0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
-    0x6f,0x6e,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x70,0x6f,0x73,0x69,
-    0x74,0x69,0x6f,0x6e,0x2e,0x78,0x2c,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
-    0x2e,0x79,0x2c,0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,
-    0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x31,0x35,0x20,0x22,0x61,0x73,0x73,0x65,0x74,
-    0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,
-    0x20,0x20,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,
-    0x64,0x3b,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x31,0x36,0x20,0x22,0x61,0x73,0x73,
+static const char texture_vs_source_hlsl5[1293] = {
+    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x30,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,
+    0x39,0x5f,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,0x78,0x20,0x3a,0x20,
+    0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,0x39,0x5f,0x74,
+    0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,0x79,0x20,0x3a,0x20,0x70,0x61,0x63,
+    0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x31,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,
+    0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,
+    0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x64,0x65,0x70,0x74,0x68,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,
+    0x64,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x63,0x6f,0x6c,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,
+    0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,
+    0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x54,0x45,0x58,
+    0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,0x64,0x20,0x3a,0x20,0x54,0x45,
+    0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,
+    0x4f,0x4f,0x52,0x44,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x64,0x65,0x70,0x74,0x68,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,
+    0x44,0x33,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,
+    0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,
+    0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,
+    0x76,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x20,0x3a,0x20,
+    0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x20,0x3a,0x20,0x53,0x56,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,
+    0x0a,0x7d,0x3b,0x0a,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x31,0x36,0x20,0x22,0x61,
+    0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,
+    0x73,0x6c,0x22,0x0a,0x76,0x6f,0x69,0x64,0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,
+    0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x31,0x36,0x20,
+    0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,
+    0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x5f,0x32,0x33,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x70,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x23,
+    0x6c,0x69,0x6e,0x65,0x20,0x31,0x37,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,
+    0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x64,0x6f,0x74,0x28,0x5f,0x31,0x39,0x5f,0x74,
+    0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,0x78,0x2e,0x78,0x79,0x7a,0x2c,0x20,
+    0x5f,0x32,0x33,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x31,0x39,0x5f,0x74,0x72,
+    0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,0x79,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x5f,
+    0x32,0x33,0x29,0x2c,0x20,0x64,0x65,0x70,0x74,0x68,0x2c,0x20,0x31,0x2e,0x30,0x66,
+    0x29,0x3b,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x31,0x38,0x20,0x22,0x61,0x73,0x73,
     0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,
-    0x22,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,
-    0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,
-    0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,
-    0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,
-    0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,
-    0x20,0x20,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x73,0x74,
-    0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,
-    0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,0x64,
-    0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x74,
-    0x65,0x78,0x63,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,
-    0x6f,0x72,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,
-    0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x72,0x74,
-    0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,
-    0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,
-    0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x67,
-    0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x67,0x6c,0x5f,
-    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,
-    0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x75,0x76,0x20,0x3d,0x20,
-    0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,
-    0x74,0x70,0x75,0x74,0x2e,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,0x67,0x65,
-    0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
+    0x22,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x74,0x65,0x78,0x63,0x6f,
+    0x6f,0x72,0x64,0x3b,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x31,0x39,0x20,0x22,0x61,
+    0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,
+    0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x63,0x6f,
+    0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,
+    0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,
+    0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,
+    0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x70,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x64,0x65,0x70,0x74,0x68,0x20,
+    0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x64,0x65,
+    0x70,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,
+    0x64,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,
+    0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,
+    0x6c,0x6f,0x72,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,
+    0x74,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x72,
+    0x74,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,
+    0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,
+    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x67,0x6c,
+    0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x75,0x76,0x20,0x3d,
+    0x20,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,
+    0x75,0x74,0x70,0x75,0x74,0x2e,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,0x67,
+    0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
 };
 /*
+    cbuffer fs_params : register(b0)
+    {
+        float _28_alpha_cutoff : packoffset(c0);
+    };
+    
     Texture2D<float4> tex : register(t0);
     SamplerState _tex_sampler : register(s0);
     
-    static float4 fragColor;
     static float2 uv;
+    static float4 fragColor;
     static float4 col;
     
     struct SPIRV_Cross_Input
@@ -395,11 +699,19 @@ static const char texture_vs_source_hlsl5[972] = {
         float4 fragColor : SV_Target0;
     };
     
-    #line 13 "assets/texture.glsl"
+    #line 35 "assets/texture.glsl"
     void frag_main()
     {
-    #line 13 "assets/texture.glsl"
-        fragColor = tex.Sample(_tex_sampler, uv) * col;
+    #line 35 "assets/texture.glsl"
+        float4 _14 = tex.Sample(_tex_sampler, uv);
+    #line 38 "assets/texture.glsl"
+        if (_14.w < _28_alpha_cutoff)
+        {
+    #line 39 "assets/texture.glsl"
+            discard;
+        }
+    #line 40 "assets/texture.glsl"
+        fragColor = _14 * col;
     }
     
     SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
@@ -412,49 +724,65 @@ static const char texture_vs_source_hlsl5[972] = {
         return stage_output;
     }
 */
-static const char texture_fs_source_hlsl5[664] = {
-    0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,
-    0x3e,0x20,0x74,0x65,0x78,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,
-    0x28,0x74,0x30,0x29,0x3b,0x0a,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x53,0x74,0x61,
-    0x74,0x65,0x20,0x5f,0x74,0x65,0x78,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,
-    0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x73,0x30,0x29,0x3b,0x0a,
-    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,
-    0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x3b,0x0a,0x73,0x74,0x61,0x74,
-    0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x3b,0x0a,0x0a,
-    0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,
-    0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,
-    0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
-    0x20,0x63,0x6f,0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,
-    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,
-    0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,
-    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,
-    0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x53,0x56,0x5f,0x54,0x61,0x72,0x67,
-    0x65,0x74,0x30,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x31,
-    0x33,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,
-    0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x76,0x6f,0x69,0x64,0x20,0x66,0x72,0x61,
-    0x67,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x23,0x6c,0x69,0x6e,0x65,
-    0x20,0x31,0x33,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,
-    0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,
-    0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x74,0x65,0x78,0x2e,0x53,0x61,
-    0x6d,0x70,0x6c,0x65,0x28,0x5f,0x74,0x65,0x78,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,
-    0x72,0x2c,0x20,0x75,0x76,0x29,0x20,0x2a,0x20,0x63,0x6f,0x6c,0x3b,0x0a,0x7d,0x0a,
-    0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,
-    0x70,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,
-    0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,
-    0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,
-    0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x75,
-    0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x73,0x74,0x61,
-    0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,
-    0x75,0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,
-    0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,
-    0x74,0x70,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,
-    0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,
-    0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
+static const char texture_fs_source_hlsl5[926] = {
+    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x30,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x38,
+    0x5f,0x61,0x6c,0x70,0x68,0x61,0x5f,0x63,0x75,0x74,0x6f,0x66,0x66,0x20,0x3a,0x20,
+    0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,
+    0x7d,0x3b,0x0a,0x0a,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x3e,0x20,0x74,0x65,0x78,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,
+    0x73,0x74,0x65,0x72,0x28,0x74,0x30,0x29,0x3b,0x0a,0x53,0x61,0x6d,0x70,0x6c,0x65,
+    0x72,0x53,0x74,0x61,0x74,0x65,0x20,0x5f,0x74,0x65,0x78,0x5f,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x72,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x73,
+    0x30,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x75,0x76,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,
+    0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,
+    0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x20,0x3a,0x20,0x54,
+    0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,
+    0x4f,0x52,0x44,0x31,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,
+    0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,
+    0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x53,0x56,0x5f,
+    0x54,0x61,0x72,0x67,0x65,0x74,0x30,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x23,0x6c,0x69,
+    0x6e,0x65,0x20,0x33,0x35,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x76,0x6f,0x69,0x64,
+    0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x23,
+    0x6c,0x69,0x6e,0x65,0x20,0x33,0x35,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,0x34,0x20,0x3d,0x20,0x74,
+    0x65,0x78,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x5f,0x74,0x65,0x78,0x5f,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x75,0x76,0x29,0x3b,0x0a,0x23,0x6c,0x69,
+    0x6e,0x65,0x20,0x33,0x38,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x5f,0x31,0x34,0x2e,0x77,0x20,0x3c,0x20,0x5f,0x32,0x38,0x5f,
+    0x61,0x6c,0x70,0x68,0x61,0x5f,0x63,0x75,0x74,0x6f,0x66,0x66,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x33,0x39,0x20,0x22,0x61,0x73,
+    0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,
+    0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x63,0x61,
+    0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,
+    0x34,0x30,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,
+    0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x5f,0x31,0x34,0x20,0x2a,0x20,0x63,
+    0x6f,0x6c,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,
+    0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,
+    0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,
+    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,
+    0x6e,0x70,0x75,0x74,0x2e,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,
+    0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x63,
+    0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,
+    0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,
+    0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,
+    0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,
+    0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x43,
+    0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
 };
 /*
     #include <metal_stdlib>
@@ -462,6 +790,12 @@ static const char texture_fs_source_hlsl5[664] = {
     
     using namespace metal;
     
+    struct vs_params
+    {
+        float4 transform_x;
+        float4 transform_y;
+    };
+    
     struct main0_out
     {
         float2 uv [[user(locn0)]];
@@ -474,195 +808,84 @@ static const char texture_fs_source_hlsl5[664] = {
         float2 position [[attribute(0)]];
         float2 texcoord [[attribute(1)]];
         float4 color [[attribute(2)]];
+        float depth [[attribute(3)]];
     };
     
-    #line 14 "assets/texture.glsl"
-    vertex main0_out main0(main0_in in [[stage_in]])
+    #line 16 "assets/texture.glsl"
+    vertex main0_out main0(main0_in in [[stage_in]], constant vs_params& _19 [[buffer(0)]])
     {
         main0_out out = {};
-    #line 14 "assets/texture.glsl"
-        out.gl_Position = float4(in.position.x, in.position.y, 0.0, 1.0);
-    #line 15 "assets/texture.glsl"
-        out.uv = in.texcoord;
     #line 16 "assets/texture.glsl"
+        float3 _23 = float3(in.position, 1.0);
+    #line 17 "assets/texture.glsl"
+        out.gl_Position = float4(dot(_19.transform_x.xyz, _23), dot(_19.transform_y.xyz, _23), in.depth, 1.0);
+    #line 18 "assets/texture.glsl"
+        out.uv = in.texcoord;
+    #line 19 "assets/texture.glsl"
         out.col = in.color;
         return out;
     }
     
 */
-static const uint8_t texture_vs_bytecode_metal_macos[2746] = {
-    0x4d,0x54,0x4c,0x42,0x01,0x80,0x02,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xba,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x6d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xb0,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x6d,0x00,0x00,0x00,
-    0x4e,0x41,0x4d,0x45,0x06,0x00,0x6d,0x61,0x69,0x6e,0x30,0x00,0x54,0x59,0x50,0x45,
-    0x01,0x00,0x00,0x48,0x41,0x53,0x48,0x20,0x00,0x18,0x2a,0x37,0x10,0x28,0x30,0xc8,
-    0x38,0xa8,0x3f,0xe2,0xa0,0xce,0xff,0xa2,0x68,0xc9,0x72,0x73,0x63,0xbe,0x75,0x3f,
-    0xd1,0xb4,0xd6,0x02,0x32,0xce,0xbf,0xbb,0x0e,0x4f,0x46,0x46,0x54,0x18,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x56,0x45,0x52,0x53,0x08,0x00,0x01,0x00,0x08,
-    0x00,0x01,0x00,0x01,0x00,0x45,0x4e,0x44,0x54,0x35,0x00,0x00,0x00,0x56,0x41,0x54,
-    0x54,0x20,0x00,0x03,0x00,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x00,0x00,0x80,
-    0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,0x64,0x00,0x01,0x80,0x63,0x6f,0x6c,0x6f,0x72,
-    0x00,0x02,0x80,0x56,0x41,0x54,0x59,0x05,0x00,0x03,0x00,0x04,0x04,0x06,0x45,0x4e,
-    0x44,0x54,0x04,0x00,0x00,0x00,0x45,0x4e,0x44,0x54,0xde,0xc0,0x17,0x0b,0x00,0x00,
-    0x00,0x00,0x14,0x00,0x00,0x00,0x90,0x09,0x00,0x00,0xff,0xff,0xff,0xff,0x42,0x43,
-    0xc0,0xde,0x21,0x0c,0x00,0x00,0x61,0x02,0x00,0x00,0x0b,0x82,0x20,0x00,0x02,0x00,
-    0x00,0x00,0x12,0x00,0x00,0x00,0x07,0x81,0x23,0x91,0x41,0xc8,0x04,0x49,0x06,0x10,
-    0x32,0x39,0x92,0x01,0x84,0x0c,0x25,0x05,0x08,0x19,0x1e,0x04,0x8b,0x62,0x80,0x10,
-    0x45,0x02,0x42,0x92,0x0b,0x42,0x84,0x10,0x32,0x14,0x38,0x08,0x18,0x49,0x0a,0x32,
-    0x44,0x24,0x48,0x0a,0x90,0x21,0x23,0xc4,0x52,0x80,0x0c,0x19,0x21,0x72,0x24,0x07,
-    0xc8,0x08,0x11,0x62,0xa8,0xa0,0xa8,0x40,0xc6,0xf0,0x01,0x00,0x00,0x00,0x51,0x18,
-    0x00,0x00,0x80,0x00,0x00,0x00,0x1b,0xc8,0x25,0xf8,0xff,0xff,0xff,0xff,0x01,0x90,
-    0x00,0x8a,0x18,0x87,0x77,0x90,0x07,0x79,0x28,0x87,0x71,0xa0,0x07,0x76,0xc8,0x87,
-    0x36,0x90,0x87,0x77,0xa8,0x07,0x77,0x20,0x87,0x72,0x20,0x87,0x36,0x20,0x87,0x74,
-    0xb0,0x87,0x74,0x20,0x87,0x72,0x68,0x83,0x79,0x88,0x07,0x79,0xa0,0x87,0x36,0x30,
-    0x07,0x78,0x68,0x83,0x76,0x08,0x07,0x7a,0x40,0x07,0xc0,0x1c,0xc2,0x81,0x1d,0xe6,
-    0xa1,0x1c,0x00,0x82,0x1c,0xd2,0x61,0x1e,0xc2,0x41,0x1c,0xd8,0xa1,0x1c,0xda,0x80,
-    0x1e,0xc2,0x21,0x1d,0xd8,0xa1,0x0d,0xc6,0x21,0x1c,0xd8,0x81,0x1d,0xe6,0x01,0x30,
-    0x87,0x70,0x60,0x87,0x79,0x28,0x07,0x80,0x60,0x87,0x72,0x98,0x87,0x79,0x68,0x03,
-    0x78,0x90,0x87,0x72,0x18,0x87,0x74,0x98,0x87,0x72,0x68,0x03,0x73,0x80,0x87,0x76,
-    0x08,0x07,0x72,0x00,0xcc,0x21,0x1c,0xd8,0x61,0x1e,0xca,0x01,0x20,0xdc,0xe1,0x1d,
-    0xda,0xc0,0x1c,0xe4,0x21,0x1c,0xda,0xa1,0x1c,0xda,0x00,0x1e,0xde,0x21,0x1d,0xdc,
-    0x81,0x1e,0xca,0x41,0x1e,0xda,0xa0,0x1c,0xd8,0x21,0x1d,0xda,0x01,0xa0,0x07,0x79,
-    0xa8,0x87,0x72,0x00,0x06,0x77,0x78,0x87,0x36,0x30,0x07,0x79,0x08,0x87,0x76,0x28,
-    0x87,0x36,0x80,0x87,0x77,0x48,0x07,0x77,0xa0,0x87,0x72,0x90,0x87,0x36,0x28,0x07,
-    0x76,0x48,0x87,0x76,0x68,0x03,0x77,0x78,0x07,0x77,0x68,0x03,0x76,0x28,0x87,0x70,
-    0x30,0x07,0x80,0x70,0x87,0x77,0x68,0x83,0x74,0x70,0x07,0x73,0x98,0x87,0x36,0x30,
-    0x07,0x78,0x68,0x83,0x76,0x08,0x07,0x7a,0x40,0x07,0x80,0x1e,0xe4,0xa1,0x1e,0xca,
-    0x01,0x20,0xdc,0xe1,0x1d,0xda,0x40,0x1d,0xea,0xa1,0x1d,0xe0,0xa1,0x0d,0xe8,0x21,
-    0x1c,0xc4,0x81,0x1d,0xca,0x61,0x1e,0x00,0x73,0x08,0x07,0x76,0x98,0x87,0x72,0x00,
-    0x08,0x77,0x78,0x87,0x36,0x70,0x87,0x70,0x70,0x87,0x79,0x68,0x03,0x73,0x80,0x87,
-    0x36,0x68,0x87,0x70,0xa0,0x07,0x74,0x00,0xe8,0x41,0x1e,0xea,0xa1,0x1c,0x00,0xc2,
-    0x1d,0xde,0xa1,0x0d,0xe6,0x21,0x1d,0xce,0xc1,0x1d,0xca,0x81,0x1c,0xda,0x40,0x1f,
-    0xca,0x41,0x1e,0xde,0x61,0x1e,0xda,0xc0,0x1c,0xe0,0xa1,0x0d,0xda,0x21,0x1c,0xe8,
-    0x01,0x1d,0x00,0x7a,0x90,0x87,0x7a,0x28,0x07,0x80,0x70,0x87,0x77,0x68,0x03,0x7a,
-    0x90,0x87,0x70,0x80,0x07,0x78,0x48,0x07,0x77,0x38,0x87,0x36,0x68,0x87,0x70,0xa0,
-    0x07,0x74,0x00,0xe8,0x41,0x1e,0xea,0xa1,0x1c,0x00,0x62,0x1e,0xe8,0x21,0x1c,0xc6,
-    0x61,0x1d,0xda,0x00,0x1e,0xe4,0xe1,0x1d,0xe8,0xa1,0x1c,0xc6,0x81,0x1e,0xde,0x41,
-    0x1e,0xda,0x40,0x1c,0xea,0xc1,0x1c,0xcc,0xa1,0x1c,0xe4,0xa1,0x0d,0xe6,0x21,0x1d,
-    0xf4,0xa1,0x1c,0x00,0x3c,0x00,0x88,0x7a,0x70,0x87,0x79,0x08,0x07,0x73,0x28,0x87,
-    0x36,0x30,0x07,0x78,0x68,0x83,0x76,0x08,0x07,0x7a,0x40,0x07,0x80,0x1e,0xe4,0xa1,
-    0x1e,0xca,0x01,0x20,0xea,0x61,0x1e,0xca,0xa1,0x0d,0xe6,0xe1,0x1d,0xcc,0x81,0x1e,
-    0xda,0xc0,0x1c,0xd8,0xe1,0x1d,0xc2,0x81,0x1e,0x00,0x73,0x08,0x07,0x76,0x98,0x87,
-    0x72,0x00,0x00,0x00,0x00,0x00,0x49,0x18,0x00,0x00,0x01,0x00,0x00,0x00,0x13,0x82,
-    0x00,0x00,0x89,0x20,0x00,0x00,0x0f,0x00,0x00,0x00,0x32,0x22,0x08,0x09,0x20,0x64,
-    0x85,0x04,0x13,0x22,0xa4,0x84,0x04,0x13,0x22,0xe3,0x84,0xa1,0x90,0x14,0x12,0x4c,
-    0x88,0x8c,0x0b,0x84,0x84,0x4c,0x10,0x2c,0x33,0x00,0xc3,0x08,0x02,0x30,0x8c,0x40,
-    0x00,0x76,0x08,0x91,0x42,0x4c,0x84,0x10,0x0d,0x04,0xcc,0x11,0x80,0x41,0x0a,0xdc,
-    0x30,0x02,0x71,0x8c,0x00,0x00,0x13,0xb2,0x70,0x48,0x07,0x79,0xb0,0x03,0x3a,0x68,
-    0x83,0x70,0x80,0x07,0x78,0x60,0x87,0x72,0x68,0x83,0x76,0x08,0x87,0x71,0x78,0x87,
-    0x79,0xc0,0x87,0x38,0x80,0x03,0x37,0x88,0x83,0x38,0x70,0x03,0x38,0xd8,0x70,0x1b,
-    0xe5,0xd0,0x06,0xf0,0xa0,0x07,0x76,0x40,0x07,0x7a,0x60,0x07,0x74,0xa0,0x07,0x76,
-    0x40,0x07,0x6d,0x90,0x0e,0x71,0xa0,0x07,0x78,0xa0,0x07,0x78,0xd0,0x06,0xe9,0x80,
-    0x07,0x7a,0x80,0x07,0x7a,0x80,0x07,0x6d,0x90,0x0e,0x71,0x60,0x07,0x7a,0x10,0x07,
-    0x76,0xa0,0x07,0x71,0x60,0x07,0x6d,0x90,0x0e,0x73,0x20,0x07,0x7a,0x30,0x07,0x72,
-    0xa0,0x07,0x73,0x20,0x07,0x6d,0x90,0x0e,0x76,0x40,0x07,0x7a,0x60,0x07,0x74,0xa0,
-    0x07,0x76,0x40,0x07,0x6d,0x60,0x0e,0x73,0x20,0x07,0x7a,0x30,0x07,0x72,0xa0,0x07,
-    0x73,0x20,0x07,0x6d,0x60,0x0e,0x76,0x40,0x07,0x7a,0x60,0x07,0x74,0xa0,0x07,0x76,
-    0x40,0x07,0x6d,0x60,0x0f,0x71,0x60,0x07,0x7a,0x10,0x07,0x76,0xa0,0x07,0x71,0x60,
-    0x07,0x6d,0x60,0x0f,0x72,0x40,0x07,0x7a,0x30,0x07,0x72,0xa0,0x07,0x73,0x20,0x07,
-    0x6d,0x60,0x0f,0x73,0x20,0x07,0x7a,0x30,0x07,0x72,0xa0,0x07,0x73,0x20,0x07,0x6d,
-    0x60,0x0f,0x74,0x80,0x07,0x7a,0x60,0x07,0x74,0xa0,0x07,0x76,0x40,0x07,0x6d,0x60,
-    0x0f,0x76,0x40,0x07,0x7a,0x60,0x07,0x74,0xa0,0x07,0x76,0x40,0x07,0x6d,0x60,0x0f,
-    0x79,0x60,0x07,0x7a,0x10,0x07,0x72,0x80,0x07,0x7a,0x10,0x07,0x72,0x80,0x07,0x6d,
-    0x60,0x0f,0x71,0x20,0x07,0x78,0xa0,0x07,0x71,0x20,0x07,0x78,0xa0,0x07,0x71,0x20,
-    0x07,0x78,0xd0,0x06,0xf6,0x10,0x07,0x79,0x20,0x07,0x7a,0x20,0x07,0x75,0x60,0x07,
-    0x7a,0x20,0x07,0x75,0x60,0x07,0x6d,0x60,0x0f,0x72,0x50,0x07,0x76,0xa0,0x07,0x72,
-    0x50,0x07,0x76,0xa0,0x07,0x72,0x50,0x07,0x76,0xd0,0x06,0xf6,0x50,0x07,0x71,0x20,
-    0x07,0x7a,0x50,0x07,0x71,0x20,0x07,0x7a,0x50,0x07,0x71,0x20,0x07,0x6d,0x60,0x0f,
-    0x71,0x00,0x07,0x72,0x40,0x07,0x7a,0x10,0x07,0x70,0x20,0x07,0x74,0xa0,0x07,0x71,
-    0x00,0x07,0x72,0x40,0x07,0x6d,0xe0,0x0e,0x78,0xa0,0x07,0x71,0x60,0x07,0x7a,0x30,
-    0x07,0x72,0x30,0x84,0x29,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0xc8,0x02,0x01,
-    0x00,0x00,0x08,0x00,0x00,0x00,0x32,0x1e,0x98,0x0c,0x19,0x11,0x4c,0x90,0x8c,0x09,
-    0x26,0x47,0xc6,0x04,0x43,0xba,0x12,0x18,0x01,0x28,0x82,0x42,0x28,0x08,0xc2,0xb1,
-    0x84,0x26,0x00,0x00,0x00,0x00,0x79,0x18,0x00,0x00,0xb0,0x00,0x00,0x00,0x1a,0x03,
-    0x4c,0x10,0x97,0x29,0xa2,0x25,0x10,0xab,0x32,0xb9,0xb9,0xb4,0x37,0xb7,0x21,0xc6,
-    0x31,0x18,0x00,0x62,0x50,0xb9,0x1b,0x43,0x0b,0x93,0xfb,0x9a,0x4b,0xd3,0x2b,0x1b,
-    0x62,0x1c,0x81,0x21,0x1c,0x04,0xe7,0x20,0x08,0x0e,0x8e,0xad,0x0c,0xa4,0xad,0x8c,
-    0x2e,0x8c,0x0d,0xc4,0xae,0x4c,0x6e,0x2e,0xed,0xcd,0x0d,0x64,0x26,0x06,0x06,0x26,
-    0xc6,0xc5,0xc6,0xe6,0x06,0x04,0xa5,0xad,0x8c,0x2e,0x8c,0xcd,0xac,0xac,0x65,0x26,
-    0x06,0x06,0x26,0xc6,0xc5,0xc6,0xe6,0xc6,0x45,0x26,0x65,0x88,0x60,0x10,0x43,0x8c,
-    0x23,0x38,0x8a,0x43,0x60,0xd1,0x54,0x46,0x17,0xc6,0x36,0x04,0x31,0x8e,0x23,0x38,
-    0x82,0x43,0xe0,0x16,0x96,0x26,0xe7,0x32,0xf6,0xd6,0x06,0x97,0xc6,0x56,0xe6,0x42,
-    0x56,0xe6,0xf6,0x26,0xd7,0x36,0xf7,0x45,0x96,0x36,0x17,0x26,0xc6,0x56,0x36,0x44,
-    0x30,0x12,0x72,0x61,0x69,0x72,0x2e,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2e,0x66,
-    0x61,0x73,0x74,0x5f,0x6d,0x61,0x74,0x68,0x5f,0x65,0x6e,0x61,0x62,0x6c,0x65,0x43,
-    0x04,0x63,0x61,0x19,0x84,0xa5,0xc9,0xb9,0x8c,0xbd,0xb5,0xc1,0xa5,0xb1,0x95,0xb9,
-    0x98,0xc9,0x85,0xb5,0x95,0x89,0xd5,0x99,0x99,0x95,0xc9,0x7d,0x99,0x95,0xd1,0x8d,
-    0xa1,0x7d,0x91,0xa5,0xcd,0x85,0x89,0xb1,0x95,0x0d,0x11,0x8c,0x86,0x51,0x58,0x9a,
-    0x9c,0x8b,0x5d,0x99,0x1c,0x5d,0x19,0xde,0xd7,0x5b,0x1d,0x1d,0x5c,0x1d,0x1d,0x97,
-    0xba,0xb9,0x32,0x39,0x14,0xb6,0xb7,0x31,0x37,0x98,0x14,0x46,0x61,0x69,0x72,0x2e,
-    0x61,0x72,0x67,0x5f,0x74,0x79,0x70,0x65,0x5f,0x6e,0x61,0x6d,0x65,0x34,0xcc,0xd8,
-    0xde,0xc2,0xe8,0x64,0xc8,0x84,0xa5,0xc9,0xb9,0x84,0xc9,0x9d,0x7d,0xb9,0x85,0xb5,
-    0x95,0x51,0xa8,0xb3,0x1b,0xc2,0x18,0x8f,0x01,0x19,0x91,0x21,0x19,0x93,0x41,0x71,
-    0xa9,0x9b,0x2b,0x93,0x43,0x61,0x7b,0x1b,0x73,0x8b,0x49,0xa1,0x61,0xc6,0xf6,0x16,
-    0x46,0x47,0xc3,0x61,0xec,0x8d,0x6d,0x08,0x63,0x3c,0x86,0x65,0x44,0xc6,0x65,0x4c,
-    0x06,0x46,0x26,0x2c,0x4d,0xce,0x05,0xee,0x6d,0x2e,0x8d,0x2e,0xed,0xcd,0x8d,0xcb,
-    0x19,0xdb,0x17,0xd4,0xdb,0x5c,0x1a,0x5d,0xda,0x9b,0xdb,0x10,0xc5,0xd0,0x8c,0xc8,
-    0xb8,0x8c,0xc9,0xd8,0x86,0x18,0x46,0x65,0x64,0x06,0x47,0x28,0x2c,0x4d,0xce,0xc5,
-    0xae,0x4c,0x8e,0xae,0x0c,0xef,0x2b,0xcd,0x0d,0xae,0x8e,0x8e,0x52,0x58,0x9a,0x9c,
-    0x0b,0xdb,0xdb,0x58,0x18,0x5d,0xda,0x9b,0xdb,0x57,0x9a,0x1b,0x59,0x19,0x1e,0xbd,
-    0xb3,0x32,0xb7,0x32,0xb9,0x30,0xba,0x32,0x32,0x94,0xaf,0xaf,0xb0,0x34,0xb9,0x2f,
-    0x38,0xb6,0xb0,0xb1,0x32,0xb4,0x37,0x36,0xb2,0x32,0xb9,0xaf,0xaf,0x14,0x22,0x70,
-    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x43,0xa8,0x43,0x30,0x3c,0xe3,0x3b,0x84,0x23,
-    0x30,0xc0,0xc0,0x88,0x0c,0xc9,0x98,0x8c,0x30,0x20,0x42,0x57,0x86,0x37,0xf6,0xf6,
-    0x26,0x47,0x36,0x84,0x3a,0x02,0xc3,0x33,0xbe,0x23,0x38,0x02,0x03,0x0c,0x8c,0xc8,
-    0x90,0x8c,0xc9,0x18,0x03,0x16,0x63,0x6f,0x6c,0x6f,0x72,0x43,0xa8,0x63,0x30,0x3c,
-    0xe3,0x3b,0x86,0x23,0x30,0xc0,0xc0,0x88,0x8c,0xcb,0x98,0x8c,0x32,0x18,0x62,0x18,
-    0x62,0x60,0x90,0x81,0x61,0x06,0x43,0x8c,0x02,0x30,0x3a,0xe3,0x0c,0x46,0x44,0xec,
-    0xc0,0x0e,0xf6,0xd0,0x0e,0x6e,0xd0,0x0e,0xef,0x40,0x0e,0xf5,0xc0,0x0e,0xe5,0xe0,
-    0x06,0xe6,0xc0,0x0e,0xe1,0x70,0x0e,0xf3,0x30,0x45,0x08,0x86,0x11,0x0a,0x3b,0xb0,
-    0x83,0x3d,0xb4,0x83,0x1b,0xa4,0x03,0x39,0x94,0x83,0x3b,0xd0,0xc3,0x94,0xa0,0x18,
-    0xb1,0x84,0x43,0x3a,0xc8,0x83,0x1b,0xd8,0x43,0x39,0xc8,0xc3,0x3c,0xa4,0xc3,0x3b,
-    0xb8,0xc3,0x94,0xc0,0x18,0x41,0x85,0x43,0x3a,0xc8,0x83,0x1b,0xb0,0x43,0x38,0xb8,
-    0xc3,0x39,0xd4,0x43,0x38,0x9c,0x43,0x39,0xfc,0x82,0x3d,0x94,0x83,0x3c,0xcc,0x43,
-    0x3a,0xbc,0x83,0x3b,0x4c,0x09,0x90,0x11,0x53,0x38,0xa4,0x83,0x3c,0xb8,0xc1,0x38,
-    0xbc,0x43,0x3b,0xc0,0x43,0x3a,0xb0,0x43,0x39,0xfc,0xc2,0x3b,0xc0,0x03,0x3d,0xa4,
-    0xc3,0x3b,0xb8,0xc3,0x3c,0x4c,0x19,0x14,0xc6,0x19,0xa1,0x84,0x43,0x3a,0xc8,0x83,
-    0x1b,0xd8,0x43,0x39,0xc8,0x03,0x3d,0x94,0x03,0x3e,0x4c,0x09,0xd0,0x00,0x79,0x18,
-    0x00,0x00,0x7b,0x00,0x00,0x00,0x33,0x08,0x80,0x1c,0xc4,0xe1,0x1c,0x66,0x14,0x01,
-    0x3d,0x88,0x43,0x38,0x84,0xc3,0x8c,0x42,0x80,0x07,0x79,0x78,0x07,0x73,0x98,0x71,
-    0x0c,0xe6,0x00,0x0f,0xed,0x10,0x0e,0xf4,0x80,0x0e,0x33,0x0c,0x42,0x1e,0xc2,0xc1,
-    0x1d,0xce,0xa1,0x1c,0x66,0x30,0x05,0x3d,0x88,0x43,0x38,0x84,0x83,0x1b,0xcc,0x03,
-    0x3d,0xc8,0x43,0x3d,0x8c,0x03,0x3d,0xcc,0x78,0x8c,0x74,0x70,0x07,0x7b,0x08,0x07,
-    0x79,0x48,0x87,0x70,0x70,0x07,0x7a,0x70,0x03,0x76,0x78,0x87,0x70,0x20,0x87,0x19,
-    0xcc,0x11,0x0e,0xec,0x90,0x0e,0xe1,0x30,0x0f,0x6e,0x30,0x0f,0xe3,0xf0,0x0e,0xf0,
-    0x50,0x0e,0x33,0x10,0xc4,0x1d,0xde,0x21,0x1c,0xd8,0x21,0x1d,0xc2,0x61,0x1e,0x66,
-    0x30,0x89,0x3b,0xbc,0x83,0x3b,0xd0,0x43,0x39,0xb4,0x03,0x3c,0xbc,0x83,0x3c,0x84,
-    0x03,0x3b,0xcc,0xf0,0x14,0x76,0x60,0x07,0x7b,0x68,0x07,0x37,0x68,0x87,0x72,0x68,
-    0x07,0x37,0x80,0x87,0x70,0x90,0x87,0x70,0x60,0x07,0x76,0x28,0x07,0x76,0xf8,0x05,
-    0x76,0x78,0x87,0x77,0x80,0x87,0x5f,0x08,0x87,0x71,0x18,0x87,0x72,0x98,0x87,0x79,
-    0x98,0x81,0x2c,0xee,0xf0,0x0e,0xee,0xe0,0x0e,0xf5,0xc0,0x0e,0xec,0x30,0x03,0x62,
-    0xc8,0xa1,0x1c,0xe4,0xa1,0x1c,0xcc,0xa1,0x1c,0xe4,0xa1,0x1c,0xdc,0x61,0x1c,0xca,
-    0x21,0x1c,0xc4,0x81,0x1d,0xca,0x61,0x06,0xd6,0x90,0x43,0x39,0xc8,0x43,0x39,0x98,
-    0x43,0x39,0xc8,0x43,0x39,0xb8,0xc3,0x38,0x94,0x43,0x38,0x88,0x03,0x3b,0x94,0xc3,
-    0x2f,0xbc,0x83,0x3c,0xfc,0x82,0x3b,0xd4,0x03,0x3b,0xb0,0xc3,0x0c,0xc7,0x69,0x87,
-    0x70,0x58,0x87,0x72,0x70,0x83,0x74,0x68,0x07,0x78,0x60,0x87,0x74,0x18,0x87,0x74,
-    0xa0,0x87,0x19,0xce,0x53,0x0f,0xee,0x00,0x0f,0xf2,0x50,0x0e,0xe4,0x90,0x0e,0xe3,
-    0x40,0x0f,0xe1,0x20,0x0e,0xec,0x50,0x0e,0x33,0x20,0x28,0x1d,0xdc,0xc1,0x1e,0xc2,
-    0x41,0x1e,0xd2,0x21,0x1c,0xdc,0x81,0x1e,0xdc,0xe0,0x1c,0xe4,0xe1,0x1d,0xea,0x01,
-    0x1e,0x66,0x18,0x51,0x38,0xb0,0x43,0x3a,0x9c,0x83,0x3b,0xcc,0x50,0x24,0x76,0x60,
-    0x07,0x7b,0x68,0x07,0x37,0x60,0x87,0x77,0x78,0x07,0x78,0x98,0x51,0x4c,0xf4,0x90,
-    0x0f,0xf0,0x50,0x0e,0x33,0x1e,0x6a,0x1e,0xca,0x61,0x1c,0xe8,0x21,0x1d,0xde,0xc1,
-    0x1d,0x7e,0x01,0x1e,0xe4,0xa1,0x1c,0xcc,0x21,0x1d,0xf0,0x61,0x06,0x54,0x85,0x83,
-    0x38,0xcc,0xc3,0x3b,0xb0,0x43,0x3d,0xd0,0x43,0x39,0xfc,0xc2,0x3c,0xe4,0x43,0x3b,
-    0x88,0xc3,0x3b,0xb0,0xc3,0x8c,0xc5,0x0a,0x87,0x79,0x98,0x87,0x77,0x18,0x87,0x74,
-    0x08,0x07,0x7a,0x28,0x07,0x72,0x98,0x81,0x5c,0xe3,0x10,0x0e,0xec,0xc0,0x0e,0xe5,
-    0x50,0x0e,0xf3,0x30,0x23,0xc1,0xd2,0x41,0x1e,0xe4,0xe1,0x17,0xd8,0xe1,0x1d,0xde,
-    0x01,0x1e,0x66,0x50,0x59,0x38,0xa4,0x83,0x3c,0xb8,0x81,0x39,0xd4,0x83,0x3b,0x8c,
-    0x03,0x3d,0xa4,0xc3,0x3b,0xb8,0xc3,0x2f,0x9c,0x83,0x3c,0xbc,0x43,0x3d,0xc0,0xc3,
-    0x3c,0x00,0x71,0x20,0x00,0x00,0x02,0x00,0x00,0x00,0x06,0x50,0x30,0x00,0xd2,0xd0,
-    0x00,0x00,0x61,0x20,0x00,0x00,0x18,0x00,0x00,0x00,0x13,0x04,0x41,0x2c,0x10,0x00,
-    0x00,0x00,0x0d,0x00,0x00,0x00,0x94,0x63,0x11,0x40,0x21,0x0c,0x73,0x10,0xc4,0x33,
-    0x38,0x73,0x10,0x4f,0xf0,0x3c,0x73,0x10,0xc2,0xf3,0x3c,0x74,0x65,0x30,0x03,0x40,
-    0x33,0x03,0x40,0x32,0x07,0x51,0x55,0xd4,0x44,0x31,0x03,0x40,0x30,0x46,0x00,0x82,
-    0x20,0x88,0x7f,0x23,0x00,0x33,0x00,0x00,0x00,0x00,0x83,0x0c,0x0f,0x91,0x0c,0x32,
-    0x40,0xc5,0x32,0xc8,0x70,0x08,0xcd,0x20,0x43,0x20,0x3c,0xb3,0x0d,0x8a,0x04,0xcc,
-    0x36,0x04,0x52,0x30,0xdb,0x10,0x0c,0x42,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+static const char texture_vs_source_metal_macos[922] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,
+    0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x74,0x72,
+    0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,0x79,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,
+    0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x20,
+    0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x20,
+    0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x70,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,
+    0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,
+    0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x30,0x29,0x5d,0x5d,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,
+    0x63,0x6f,0x6f,0x72,0x64,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,
+    0x65,0x28,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,
+    0x62,0x75,0x74,0x65,0x28,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x64,0x65,0x70,0x74,0x68,0x20,0x5b,0x5b,0x61,0x74,0x74,
+    0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,
+    0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x31,0x36,0x20,0x22,0x61,0x73,0x73,0x65,0x74,
+    0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,
+    0x76,0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,
+    0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,
+    0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x2c,
+    0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x26,0x20,0x5f,0x31,0x39,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,
+    0x72,0x28,0x30,0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,
+    0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,
+    0x3b,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x31,0x36,0x20,0x22,0x61,0x73,0x73,0x65,
+    0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x32,0x33,0x20,
+    0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x69,0x6e,0x2e,0x70,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x23,0x6c,0x69,0x6e,
+    0x65,0x20,0x31,0x37,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x6f,
+    0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x64,0x6f,0x74,0x28,0x5f,0x31,0x39,0x2e,
+    0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,0x78,0x2e,0x78,0x79,0x7a,0x2c,
+    0x20,0x5f,0x32,0x33,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x31,0x39,0x2e,0x74,
+    0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,0x79,0x2e,0x78,0x79,0x7a,0x2c,0x20,
+    0x5f,0x32,0x33,0x29,0x2c,0x20,0x69,0x6e,0x2e,0x64,0x65,0x70,0x74,0x68,0x2c,0x20,
+    0x31,0x2e,0x30,0x29,0x3b,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x31,0x38,0x20,0x22,
+    0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,
+    0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x75,0x76,0x20,
+    0x3d,0x20,0x69,0x6e,0x2e,0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x23,
+    0x6c,0x69,0x6e,0x65,0x20,0x31,0x39,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,
+    0x20,0x20,0x6f,0x75,0x74,0x2e,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x63,
+    0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
 /*
     #include <metal_stdlib>
@@ -670,6 +893,11 @@ static const uint8_t texture_vs_bytecode_metal_macos[2746] = {
     
     using namespace metal;
     
+    struct fs_params
+    {
+        float alpha_cutoff;
+    };
+    
     struct main0_out
     {
         float4 fragColor [[color(0)]];
@@ -681,441 +909,4112 @@ static const uint8_t texture_vs_bytecode_metal_macos[2746] = {
         float4 col [[user(locn1)]];
     };
     
-    #line 13 "assets/texture.glsl"
-    fragment main0_out main0(main0_in in [[stage_in]], texture2d<float> tex [[texture(0)]], sampler texSmplr [[sampler(0)]])
+    #line 35 "assets/texture.glsl"
+    fragment main0_out main0(main0_in in [[stage_in]], texture2d<float> tex [[texture(0)]], constant fs_params& _28 [[buffer(0)]], sampler texSmplr [[sampler(0)]])
     {
         main0_out out = {};
-    #line 13 "assets/texture.glsl"
-        out.fragColor = tex.sample(texSmplr, in.uv) * in.col;
+    #line 35 "assets/texture.glsl"
+        float4 _14 = tex.sample(texSmplr, in.uv);
+    #line 38 "assets/texture.glsl"
+        if (_14.w < _28.alpha_cutoff)
+        {
+    #line 39 "assets/texture.glsl"
+            discard_fragment();
+        }
+    #line 40 "assets/texture.glsl"
+        out.fragColor = _14 * in.col;
         return out;
     }
     
 */
-static const uint8_t texture_fs_bytecode_metal_macos[2809] = {
-    0x4d,0x54,0x4c,0x42,0x01,0x80,0x02,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xf9,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x58,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x6d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x20,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x6d,0x00,0x00,0x00,
-    0x4e,0x41,0x4d,0x45,0x06,0x00,0x6d,0x61,0x69,0x6e,0x30,0x00,0x54,0x59,0x50,0x45,
-    0x01,0x00,0x01,0x48,0x41,0x53,0x48,0x20,0x00,0x99,0x00,0x32,0x2c,0xea,0x1f,0xe2,
-    0x30,0x3a,0x69,0xdc,0xe1,0xdf,0xaa,0x94,0xbf,0xab,0x12,0xc6,0x64,0x2a,0x06,0x53,
-    0x38,0x18,0xa1,0x37,0xe7,0x6b,0x3f,0x51,0xea,0x4f,0x46,0x46,0x54,0x18,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x56,0x45,0x52,0x53,0x08,0x00,0x01,0x00,0x08,
-    0x00,0x01,0x00,0x01,0x00,0x45,0x4e,0x44,0x54,0x04,0x00,0x00,0x00,0x45,0x4e,0x44,
-    0x54,0x04,0x00,0x00,0x00,0x45,0x4e,0x44,0x54,0xde,0xc0,0x17,0x0b,0x00,0x00,0x00,
-    0x00,0x14,0x00,0x00,0x00,0x0c,0x0a,0x00,0x00,0xff,0xff,0xff,0xff,0x42,0x43,0xc0,
-    0xde,0x21,0x0c,0x00,0x00,0x80,0x02,0x00,0x00,0x0b,0x82,0x20,0x00,0x02,0x00,0x00,
-    0x00,0x12,0x00,0x00,0x00,0x07,0x81,0x23,0x91,0x41,0xc8,0x04,0x49,0x06,0x10,0x32,
-    0x39,0x92,0x01,0x84,0x0c,0x25,0x05,0x08,0x19,0x1e,0x04,0x8b,0x62,0x80,0x14,0x45,
-    0x02,0x42,0x92,0x0b,0x42,0xa4,0x10,0x32,0x14,0x38,0x08,0x18,0x49,0x0a,0x32,0x44,
-    0x24,0x48,0x0a,0x90,0x21,0x23,0xc4,0x52,0x80,0x0c,0x19,0x21,0x72,0x24,0x07,0xc8,
-    0x48,0x11,0x62,0xa8,0xa0,0xa8,0x40,0xc6,0xf0,0x01,0x00,0x00,0x00,0x51,0x18,0x00,
-    0x00,0x89,0x00,0x00,0x00,0x1b,0xcc,0x25,0xf8,0xff,0xff,0xff,0xff,0x01,0x60,0x00,
-    0x09,0xa8,0x88,0x71,0x78,0x07,0x79,0x90,0x87,0x72,0x18,0x07,0x7a,0x60,0x87,0x7c,
-    0x68,0x03,0x79,0x78,0x87,0x7a,0x70,0x07,0x72,0x28,0x07,0x72,0x68,0x03,0x72,0x48,
-    0x07,0x7b,0x48,0x07,0x72,0x28,0x87,0x36,0x98,0x87,0x78,0x90,0x07,0x7a,0x68,0x03,
-    0x73,0x80,0x87,0x36,0x68,0x87,0x70,0xa0,0x07,0x74,0x00,0xcc,0x21,0x1c,0xd8,0x61,
-    0x1e,0xca,0x01,0x20,0xc8,0x21,0x1d,0xe6,0x21,0x1c,0xc4,0x81,0x1d,0xca,0xa1,0x0d,
-    0xe8,0x21,0x1c,0xd2,0x81,0x1d,0xda,0x60,0x1c,0xc2,0x81,0x1d,0xd8,0x61,0x1e,0x00,
-    0x73,0x08,0x07,0x76,0x98,0x87,0x72,0x00,0x08,0x76,0x28,0x87,0x79,0x98,0x87,0x36,
-    0x80,0x07,0x79,0x28,0x87,0x71,0x48,0x87,0x79,0x28,0x87,0x36,0x30,0x07,0x78,0x68,
-    0x87,0x70,0x20,0x07,0xc0,0x1c,0xc2,0x81,0x1d,0xe6,0xa1,0x1c,0x00,0xc2,0x1d,0xde,
-    0xa1,0x0d,0xcc,0x41,0x1e,0xc2,0xa1,0x1d,0xca,0xa1,0x0d,0xe0,0xe1,0x1d,0xd2,0xc1,
-    0x1d,0xe8,0xa1,0x1c,0xe4,0xa1,0x0d,0xca,0x81,0x1d,0xd2,0xa1,0x1d,0x00,0x7a,0x90,
-    0x87,0x7a,0x28,0x07,0x60,0x70,0x87,0x77,0x68,0x03,0x73,0x90,0x87,0x70,0x68,0x87,
-    0x72,0x68,0x03,0x78,0x78,0x87,0x74,0x70,0x07,0x7a,0x28,0x07,0x79,0x68,0x83,0x72,
-    0x60,0x87,0x74,0x68,0x87,0x36,0x70,0x87,0x77,0x70,0x87,0x36,0x60,0x87,0x72,0x08,
-    0x07,0x73,0x00,0x08,0x77,0x78,0x87,0x36,0x48,0x07,0x77,0x30,0x87,0x79,0x68,0x03,
-    0x73,0x80,0x87,0x36,0x68,0x87,0x70,0xa0,0x07,0x74,0x00,0xe8,0x41,0x1e,0xea,0xa1,
-    0x1c,0x00,0xc2,0x1d,0xde,0xa1,0x0d,0xd4,0xa1,0x1e,0xda,0x01,0x1e,0xda,0x80,0x1e,
-    0xc2,0x41,0x1c,0xd8,0xa1,0x1c,0xe6,0x01,0x30,0x87,0x70,0x60,0x87,0x79,0x28,0x07,
-    0x80,0x70,0x87,0x77,0x68,0x03,0x77,0x08,0x07,0x77,0x98,0x87,0x36,0x30,0x07,0x78,
-    0x68,0x83,0x76,0x08,0x07,0x7a,0x40,0x07,0x80,0x1e,0xe4,0xa1,0x1e,0xca,0x01,0x20,
-    0xdc,0xe1,0x1d,0xda,0x60,0x1e,0xd2,0xe1,0x1c,0xdc,0xa1,0x1c,0xc8,0xa1,0x0d,0xf4,
-    0xa1,0x1c,0xe4,0xe1,0x1d,0xe6,0xa1,0x0d,0xcc,0x01,0x1e,0xda,0xa0,0x1d,0xc2,0x81,
-    0x1e,0xd0,0x01,0xa0,0x07,0x79,0xa8,0x87,0x72,0x00,0x08,0x77,0x78,0x87,0x36,0xa0,
-    0x07,0x79,0x08,0x07,0x78,0x80,0x87,0x74,0x70,0x87,0x73,0x68,0x83,0x76,0x08,0x07,
-    0x7a,0x40,0x07,0x80,0x1e,0xe4,0xa1,0x1e,0xca,0x01,0x20,0xe6,0x81,0x1e,0xc2,0x61,
-    0x1c,0xd6,0xa1,0x0d,0xe0,0x41,0x1e,0xde,0x81,0x1e,0xca,0x61,0x1c,0xe8,0xe1,0x1d,
-    0xe4,0xa1,0x0d,0xc4,0xa1,0x1e,0xcc,0xc1,0x1c,0xca,0x41,0x1e,0xda,0x60,0x1e,0xd2,
-    0x41,0x1f,0xca,0x01,0xc0,0x03,0x80,0xa8,0x07,0x77,0x98,0x87,0x70,0x30,0x87,0x72,
-    0x68,0x03,0x73,0x80,0x87,0x36,0x68,0x87,0x70,0xa0,0x07,0x74,0x00,0xe8,0x41,0x1e,
-    0xea,0xa1,0x1c,0x00,0xa2,0x1e,0xe6,0xa1,0x1c,0xda,0x60,0x1e,0xde,0xc1,0x1c,0xe8,
-    0xa1,0x0d,0xcc,0x81,0x1d,0xde,0x21,0x1c,0xe8,0x01,0x30,0x87,0x70,0x60,0x87,0x79,
-    0x28,0x07,0x60,0x83,0x21,0x0c,0xc0,0x02,0x54,0x1b,0x8c,0x81,0x00,0x16,0xa0,0xda,
-    0x80,0x10,0xff,0xff,0xff,0xff,0x3f,0x00,0x0c,0x20,0x01,0xd5,0x06,0xa3,0x08,0x80,
-    0x05,0xa8,0x36,0x18,0x86,0x00,0x2c,0x40,0x05,0x49,0x18,0x00,0x00,0x03,0x00,0x00,
-    0x00,0x13,0x86,0x40,0x18,0x26,0x0c,0x44,0x61,0x00,0x00,0x00,0x00,0x89,0x20,0x00,
-    0x00,0x1d,0x00,0x00,0x00,0x32,0x22,0x48,0x09,0x20,0x64,0x85,0x04,0x93,0x22,0xa4,
-    0x84,0x04,0x93,0x22,0xe3,0x84,0xa1,0x90,0x14,0x12,0x4c,0x8a,0x8c,0x0b,0x84,0xa4,
-    0x4c,0x10,0x48,0x33,0x00,0xc3,0x08,0x04,0x60,0x83,0x30,0x8c,0x20,0x00,0x47,0x49,
-    0x53,0x44,0x09,0x93,0xff,0x4f,0xc4,0x35,0x51,0x11,0xf1,0xdb,0xc3,0x3f,0x8d,0x11,
-    0x00,0x83,0x08,0x44,0x70,0x91,0x34,0x45,0x94,0x30,0xf9,0xbf,0x04,0x30,0xcf,0x42,
-    0x44,0xff,0x34,0x46,0x00,0x0c,0x22,0x18,0x42,0x29,0xc4,0x08,0xe5,0x10,0x9a,0x23,
-    0x08,0xe6,0x08,0xc0,0x60,0x18,0x41,0x58,0x0a,0x12,0xca,0x19,0x8a,0x29,0x40,0x6d,
-    0x20,0x20,0x05,0xd6,0x08,0x00,0x00,0x00,0x00,0x13,0xb2,0x70,0x48,0x07,0x79,0xb0,
-    0x03,0x3a,0x68,0x83,0x70,0x80,0x07,0x78,0x60,0x87,0x72,0x68,0x83,0x76,0x08,0x87,
-    0x71,0x78,0x87,0x79,0xc0,0x87,0x38,0x80,0x03,0x37,0x88,0x83,0x38,0x70,0x03,0x38,
-    0xd8,0x70,0x1b,0xe5,0xd0,0x06,0xf0,0xa0,0x07,0x76,0x40,0x07,0x7a,0x60,0x07,0x74,
-    0xa0,0x07,0x76,0x40,0x07,0x6d,0x90,0x0e,0x71,0xa0,0x07,0x78,0xa0,0x07,0x78,0xd0,
-    0x06,0xe9,0x80,0x07,0x7a,0x80,0x07,0x7a,0x80,0x07,0x6d,0x90,0x0e,0x71,0x60,0x07,
-    0x7a,0x10,0x07,0x76,0xa0,0x07,0x71,0x60,0x07,0x6d,0x90,0x0e,0x73,0x20,0x07,0x7a,
-    0x30,0x07,0x72,0xa0,0x07,0x73,0x20,0x07,0x6d,0x90,0x0e,0x76,0x40,0x07,0x7a,0x60,
-    0x07,0x74,0xa0,0x07,0x76,0x40,0x07,0x6d,0x60,0x0e,0x73,0x20,0x07,0x7a,0x30,0x07,
-    0x72,0xa0,0x07,0x73,0x20,0x07,0x6d,0x60,0x0e,0x76,0x40,0x07,0x7a,0x60,0x07,0x74,
-    0xa0,0x07,0x76,0x40,0x07,0x6d,0x60,0x0f,0x71,0x60,0x07,0x7a,0x10,0x07,0x76,0xa0,
-    0x07,0x71,0x60,0x07,0x6d,0x60,0x0f,0x72,0x40,0x07,0x7a,0x30,0x07,0x72,0xa0,0x07,
-    0x73,0x20,0x07,0x6d,0x60,0x0f,0x73,0x20,0x07,0x7a,0x30,0x07,0x72,0xa0,0x07,0x73,
-    0x20,0x07,0x6d,0x60,0x0f,0x74,0x80,0x07,0x7a,0x60,0x07,0x74,0xa0,0x07,0x76,0x40,
-    0x07,0x6d,0x60,0x0f,0x76,0x40,0x07,0x7a,0x60,0x07,0x74,0xa0,0x07,0x76,0x40,0x07,
-    0x6d,0x60,0x0f,0x79,0x60,0x07,0x7a,0x10,0x07,0x72,0x80,0x07,0x7a,0x10,0x07,0x72,
-    0x80,0x07,0x6d,0x60,0x0f,0x71,0x20,0x07,0x78,0xa0,0x07,0x71,0x20,0x07,0x78,0xa0,
-    0x07,0x71,0x20,0x07,0x78,0xd0,0x06,0xf6,0x10,0x07,0x79,0x20,0x07,0x7a,0x20,0x07,
-    0x75,0x60,0x07,0x7a,0x20,0x07,0x75,0x60,0x07,0x6d,0x60,0x0f,0x72,0x50,0x07,0x76,
-    0xa0,0x07,0x72,0x50,0x07,0x76,0xa0,0x07,0x72,0x50,0x07,0x76,0xd0,0x06,0xf6,0x50,
-    0x07,0x71,0x20,0x07,0x7a,0x50,0x07,0x71,0x20,0x07,0x7a,0x50,0x07,0x71,0x20,0x07,
-    0x6d,0x60,0x0f,0x71,0x00,0x07,0x72,0x40,0x07,0x7a,0x10,0x07,0x70,0x20,0x07,0x74,
-    0xa0,0x07,0x71,0x00,0x07,0x72,0x40,0x07,0x6d,0xe0,0x0e,0x78,0xa0,0x07,0x71,0x60,
-    0x07,0x7a,0x30,0x07,0x72,0x30,0x84,0x49,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,
-    0x18,0xc2,0x38,0x40,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x64,0x81,0x00,0x00,0x00,
-    0x00,0x08,0x00,0x00,0x00,0x32,0x1e,0x98,0x10,0x19,0x11,0x4c,0x90,0x8c,0x09,0x26,
-    0x47,0xc6,0x04,0x43,0x5a,0x25,0x30,0x02,0x50,0x04,0x85,0x50,0x10,0x65,0x40,0x70,
-    0x2c,0xa1,0x09,0x00,0x00,0x79,0x18,0x00,0x00,0xb9,0x00,0x00,0x00,0x1a,0x03,0x4c,
-    0x10,0x97,0x29,0xa2,0x25,0x10,0xab,0x32,0xb9,0xb9,0xb4,0x37,0xb7,0x21,0xc6,0x42,
-    0x3c,0x00,0x84,0x50,0xb9,0x1b,0x43,0x0b,0x93,0xfb,0x9a,0x4b,0xd3,0x2b,0x1b,0x62,
-    0x2c,0xc2,0x23,0x2c,0x05,0xe7,0x20,0x08,0x0e,0x8e,0xad,0x0c,0xa4,0xad,0x8c,0x2e,
-    0x8c,0x0d,0xc4,0xae,0x4c,0x6e,0x2e,0xed,0xcd,0x0d,0x64,0x26,0x06,0x06,0x26,0xc6,
-    0xc5,0xc6,0xe6,0x06,0x04,0xa5,0xad,0x8c,0x2e,0x8c,0xcd,0xac,0xac,0x65,0x26,0x06,
-    0x06,0x26,0xc6,0xc5,0xc6,0xe6,0xc6,0x45,0x26,0x65,0x88,0xf0,0x10,0x43,0x8c,0x45,
-    0x58,0x8c,0x65,0x60,0xd1,0x54,0x46,0x17,0xc6,0x36,0x04,0x79,0x8e,0x45,0x58,0x84,
-    0x65,0xe0,0x16,0x96,0x26,0xe7,0x32,0xf6,0xd6,0x06,0x97,0xc6,0x56,0xe6,0x42,0x56,
-    0xe6,0xf6,0x26,0xd7,0x36,0xf7,0x45,0x96,0x36,0x17,0x26,0xc6,0x56,0x36,0x44,0x78,
-    0x12,0x72,0x61,0x69,0x72,0x2e,0x63,0x6f,0x6d,0x70,0x69,0x6c,0x65,0x2e,0x66,0x61,
-    0x73,0x74,0x5f,0x6d,0x61,0x74,0x68,0x5f,0x65,0x6e,0x61,0x62,0x6c,0x65,0x43,0x84,
-    0x67,0x61,0x19,0x84,0xa5,0xc9,0xb9,0x8c,0xbd,0xb5,0xc1,0xa5,0xb1,0x95,0xb9,0x98,
-    0xc9,0x85,0xb5,0x95,0x89,0xd5,0x99,0x99,0x95,0xc9,0x7d,0x99,0x95,0xd1,0x8d,0xa1,
-    0x7d,0x91,0xa5,0xcd,0x85,0x89,0xb1,0x95,0x0d,0x11,0x9e,0x86,0x51,0x58,0x9a,0x9c,
-    0x8b,0x5c,0x99,0x1b,0x59,0x99,0xdc,0x17,0x5d,0x98,0xdc,0x59,0x19,0x1d,0xa3,0xb0,
-    0x34,0x39,0x97,0x30,0xb9,0xb3,0x2f,0xba,0x3c,0xb8,0xb2,0x2f,0xb7,0xb0,0xb6,0x32,
-    0x1a,0x66,0x6c,0x6f,0x61,0x74,0x34,0x64,0xc2,0xd2,0xe4,0x5c,0xc2,0xe4,0xce,0xbe,
-    0xdc,0xc2,0xda,0xca,0x98,0x98,0xc9,0x85,0x9d,0x0d,0xbd,0xb1,0xbd,0xc9,0x0d,0x61,
-    0x9e,0x67,0x19,0x1e,0xe8,0x89,0x1e,0xe9,0x99,0x86,0x08,0x0f,0x45,0x29,0x2c,0x4d,
-    0xce,0xc5,0x4c,0x2e,0xec,0xac,0xad,0xcc,0x8d,0xee,0x2b,0xcd,0x0d,0xae,0x8e,0x8e,
-    0x4b,0xdd,0x5c,0x99,0x1c,0x0a,0xdb,0xdb,0x98,0x1b,0x4c,0x0a,0x95,0xb0,0x34,0x39,
-    0x97,0xb1,0x32,0x37,0xba,0x32,0x39,0x3e,0x61,0x69,0x72,0x2e,0x70,0x65,0x72,0x73,
-    0x70,0x65,0x63,0x74,0x69,0x76,0x65,0x34,0xcc,0xd8,0xde,0xc2,0xe8,0x64,0x28,0xd4,
-    0xd9,0x0d,0x91,0x96,0xe1,0xb1,0x9e,0xeb,0xc1,0x9e,0xec,0x81,0x1e,0xed,0x91,0x9e,
-    0x8d,0x4b,0xdd,0x5c,0x99,0x1c,0x0a,0xdb,0xdb,0x98,0x5b,0x4c,0x0a,0x87,0xb1,0x37,
-    0xb6,0x21,0xd2,0x22,0x3c,0xd6,0xd3,0x3d,0xd8,0x93,0x3d,0xd0,0x13,0x3d,0xd2,0xe3,
-    0x71,0x09,0x4b,0x93,0x73,0xa1,0x2b,0xc3,0xa3,0xab,0x93,0x2b,0xa3,0x14,0x96,0x26,
-    0xe7,0xc2,0xf6,0x36,0x16,0x46,0x97,0xf6,0xe6,0xf6,0x95,0xe6,0x46,0x56,0x86,0x47,
-    0x25,0x2c,0x4d,0xce,0x65,0x2e,0xac,0x0d,0x8e,0xad,0x8c,0x18,0x5d,0x19,0x1e,0x5d,
-    0x9d,0x5c,0x99,0x0c,0x19,0x8f,0x19,0xdb,0x5b,0x18,0x1d,0x0b,0xc8,0x5c,0x58,0x1b,
-    0x1c,0x5b,0x99,0x0f,0x07,0xba,0x32,0xbc,0x21,0xd4,0x42,0x3c,0x60,0xf0,0x84,0xc1,
-    0x32,0x2c,0xc2,0x23,0x06,0x0f,0xf4,0x8c,0xc1,0x23,0x3d,0x64,0xc0,0x25,0x2c,0x4d,
-    0xce,0x65,0x2e,0xac,0x0d,0x8e,0xad,0x4c,0x8e,0xc7,0x5c,0x58,0x1b,0x1c,0x5b,0x99,
-    0x1c,0x11,0xba,0x32,0xbc,0xa9,0x36,0x38,0x36,0xb9,0x21,0xd2,0x72,0x3c,0x66,0xf0,
-    0x84,0xc1,0x32,0x2c,0xc2,0x03,0x3d,0x67,0xf0,0x48,0x0f,0x1a,0x0c,0x41,0x1e,0xee,
-    0xf9,0x9e,0x32,0x78,0xd2,0x60,0x88,0x91,0x00,0x4f,0xf5,0xa8,0xc1,0x88,0x88,0x1d,
-    0xd8,0xc1,0x1e,0xda,0xc1,0x0d,0xda,0xe1,0x1d,0xc8,0xa1,0x1e,0xd8,0xa1,0x1c,0xdc,
-    0xc0,0x1c,0xd8,0x21,0x1c,0xce,0x61,0x1e,0xa6,0x08,0xc1,0x30,0x42,0x61,0x07,0x76,
-    0xb0,0x87,0x76,0x70,0x83,0x74,0x20,0x87,0x72,0x70,0x07,0x7a,0x98,0x12,0x14,0x23,
-    0x96,0x70,0x48,0x07,0x79,0x70,0x03,0x7b,0x28,0x07,0x79,0x98,0x87,0x74,0x78,0x07,
-    0x77,0x98,0x12,0x18,0x23,0xa8,0x70,0x48,0x07,0x79,0x70,0x03,0x76,0x08,0x07,0x77,
-    0x38,0x87,0x7a,0x08,0x87,0x73,0x28,0x87,0x5f,0xb0,0x87,0x72,0x90,0x87,0x79,0x48,
-    0x87,0x77,0x70,0x87,0x29,0x01,0x32,0x62,0x0a,0x87,0x74,0x90,0x07,0x37,0x18,0x87,
-    0x77,0x68,0x07,0x78,0x48,0x07,0x76,0x28,0x87,0x5f,0x78,0x07,0x78,0xa0,0x87,0x74,
-    0x78,0x07,0x77,0x98,0x87,0x29,0x83,0xc2,0x38,0x23,0x98,0x70,0x48,0x07,0x79,0x70,
-    0x03,0x73,0x90,0x87,0x70,0x38,0x87,0x76,0x28,0x07,0x77,0xa0,0x87,0x29,0xc1,0x1a,
-    0x00,0x79,0x18,0x00,0x00,0x7b,0x00,0x00,0x00,0x33,0x08,0x80,0x1c,0xc4,0xe1,0x1c,
-    0x66,0x14,0x01,0x3d,0x88,0x43,0x38,0x84,0xc3,0x8c,0x42,0x80,0x07,0x79,0x78,0x07,
-    0x73,0x98,0x71,0x0c,0xe6,0x00,0x0f,0xed,0x10,0x0e,0xf4,0x80,0x0e,0x33,0x0c,0x42,
-    0x1e,0xc2,0xc1,0x1d,0xce,0xa1,0x1c,0x66,0x30,0x05,0x3d,0x88,0x43,0x38,0x84,0x83,
-    0x1b,0xcc,0x03,0x3d,0xc8,0x43,0x3d,0x8c,0x03,0x3d,0xcc,0x78,0x8c,0x74,0x70,0x07,
-    0x7b,0x08,0x07,0x79,0x48,0x87,0x70,0x70,0x07,0x7a,0x70,0x03,0x76,0x78,0x87,0x70,
-    0x20,0x87,0x19,0xcc,0x11,0x0e,0xec,0x90,0x0e,0xe1,0x30,0x0f,0x6e,0x30,0x0f,0xe3,
-    0xf0,0x0e,0xf0,0x50,0x0e,0x33,0x10,0xc4,0x1d,0xde,0x21,0x1c,0xd8,0x21,0x1d,0xc2,
-    0x61,0x1e,0x66,0x30,0x89,0x3b,0xbc,0x83,0x3b,0xd0,0x43,0x39,0xb4,0x03,0x3c,0xbc,
-    0x83,0x3c,0x84,0x03,0x3b,0xcc,0xf0,0x14,0x76,0x60,0x07,0x7b,0x68,0x07,0x37,0x68,
-    0x87,0x72,0x68,0x07,0x37,0x80,0x87,0x70,0x90,0x87,0x70,0x60,0x07,0x76,0x28,0x07,
-    0x76,0xf8,0x05,0x76,0x78,0x87,0x77,0x80,0x87,0x5f,0x08,0x87,0x71,0x18,0x87,0x72,
-    0x98,0x87,0x79,0x98,0x81,0x2c,0xee,0xf0,0x0e,0xee,0xe0,0x0e,0xf5,0xc0,0x0e,0xec,
-    0x30,0x03,0x62,0xc8,0xa1,0x1c,0xe4,0xa1,0x1c,0xcc,0xa1,0x1c,0xe4,0xa1,0x1c,0xdc,
-    0x61,0x1c,0xca,0x21,0x1c,0xc4,0x81,0x1d,0xca,0x61,0x06,0xd6,0x90,0x43,0x39,0xc8,
-    0x43,0x39,0x98,0x43,0x39,0xc8,0x43,0x39,0xb8,0xc3,0x38,0x94,0x43,0x38,0x88,0x03,
-    0x3b,0x94,0xc3,0x2f,0xbc,0x83,0x3c,0xfc,0x82,0x3b,0xd4,0x03,0x3b,0xb0,0xc3,0x0c,
-    0xc7,0x69,0x87,0x70,0x58,0x87,0x72,0x70,0x83,0x74,0x68,0x07,0x78,0x60,0x87,0x74,
-    0x18,0x87,0x74,0xa0,0x87,0x19,0xce,0x53,0x0f,0xee,0x00,0x0f,0xf2,0x50,0x0e,0xe4,
-    0x90,0x0e,0xe3,0x40,0x0f,0xe1,0x20,0x0e,0xec,0x50,0x0e,0x33,0x20,0x28,0x1d,0xdc,
-    0xc1,0x1e,0xc2,0x41,0x1e,0xd2,0x21,0x1c,0xdc,0x81,0x1e,0xdc,0xe0,0x1c,0xe4,0xe1,
-    0x1d,0xea,0x01,0x1e,0x66,0x18,0x51,0x38,0xb0,0x43,0x3a,0x9c,0x83,0x3b,0xcc,0x50,
-    0x24,0x76,0x60,0x07,0x7b,0x68,0x07,0x37,0x60,0x87,0x77,0x78,0x07,0x78,0x98,0x51,
-    0x4c,0xf4,0x90,0x0f,0xf0,0x50,0x0e,0x33,0x1e,0x6a,0x1e,0xca,0x61,0x1c,0xe8,0x21,
-    0x1d,0xde,0xc1,0x1d,0x7e,0x01,0x1e,0xe4,0xa1,0x1c,0xcc,0x21,0x1d,0xf0,0x61,0x06,
-    0x54,0x85,0x83,0x38,0xcc,0xc3,0x3b,0xb0,0x43,0x3d,0xd0,0x43,0x39,0xfc,0xc2,0x3c,
-    0xe4,0x43,0x3b,0x88,0xc3,0x3b,0xb0,0xc3,0x8c,0xc5,0x0a,0x87,0x79,0x98,0x87,0x77,
-    0x18,0x87,0x74,0x08,0x07,0x7a,0x28,0x07,0x72,0x98,0x81,0x5c,0xe3,0x10,0x0e,0xec,
-    0xc0,0x0e,0xe5,0x50,0x0e,0xf3,0x30,0x23,0xc1,0xd2,0x41,0x1e,0xe4,0xe1,0x17,0xd8,
-    0xe1,0x1d,0xde,0x01,0x1e,0x66,0x50,0x59,0x38,0xa4,0x83,0x3c,0xb8,0x81,0x39,0xd4,
-    0x83,0x3b,0x8c,0x03,0x3d,0xa4,0xc3,0x3b,0xb8,0xc3,0x2f,0x9c,0x83,0x3c,0xbc,0x43,
-    0x3d,0xc0,0xc3,0x3c,0x00,0x71,0x20,0x00,0x00,0x08,0x00,0x00,0x00,0x16,0xb0,0x01,
-    0x48,0xe4,0x4b,0x00,0xf3,0x2c,0xc4,0x3f,0x11,0xd7,0x44,0x45,0xc4,0x6f,0x0f,0x7e,
-    0x85,0x17,0xb7,0x6d,0x00,0x05,0x03,0x20,0x0d,0x0d,0x00,0x00,0x00,0x61,0x20,0x00,
-    0x00,0x0c,0x00,0x00,0x00,0x13,0x04,0x41,0x2c,0x10,0x00,0x00,0x00,0x04,0x00,0x00,
-    0x00,0xc4,0x46,0x00,0x48,0x8d,0x00,0xd4,0x00,0x89,0x19,0x00,0x02,0x23,0x00,0x00,
-    0x00,0x23,0x06,0x8a,0x10,0x44,0x87,0x91,0x0c,0x05,0x11,0x58,0x90,0xc8,0x67,0xb6,
-    0x81,0x08,0x80,0x0c,0x00,0x00,0x00,0x00,0x00,
+static const char texture_fs_source_metal_macos[777] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x61,0x6c,0x70,0x68,0x61,0x5f,0x63,0x75,0x74,0x6f,0x66,
+    0x66,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,
+    0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x5b,
+    0x5b,0x63,0x6f,0x6c,0x6f,0x72,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,
+    0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,
+    0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x33,0x35,0x20,0x22,
+    0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,
+    0x6c,0x73,0x6c,0x22,0x0a,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x20,0x6d,0x61,
+    0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,
+    0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,
+    0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,
+    0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x74,0x65,0x78,0x20,0x5b,0x5b,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x61,0x6e,0x74,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,
+    0x20,0x5f,0x32,0x38,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,
+    0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x74,0x65,0x78,0x53,
+    0x6d,0x70,0x6c,0x72,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x30,
+    0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,
+    0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x23,
+    0x6c,0x69,0x6e,0x65,0x20,0x33,0x35,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,0x34,0x20,0x3d,0x20,0x74,
+    0x65,0x78,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x74,0x65,0x78,0x53,0x6d,0x70,
+    0x6c,0x72,0x2c,0x20,0x69,0x6e,0x2e,0x75,0x76,0x29,0x3b,0x0a,0x23,0x6c,0x69,0x6e,
+    0x65,0x20,0x33,0x38,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x5f,0x31,0x34,0x2e,0x77,0x20,0x3c,0x20,0x5f,0x32,0x38,0x2e,0x61,
+    0x6c,0x70,0x68,0x61,0x5f,0x63,0x75,0x74,0x6f,0x66,0x66,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x33,0x39,0x20,0x22,0x61,0x73,0x73,
+    0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,
+    0x22,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x63,0x61,0x72,
+    0x64,0x5f,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x28,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x34,0x30,0x20,0x22,0x61,0x73,
+    0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,
+    0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x43,
+    0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x5f,0x31,0x34,0x20,0x2a,0x20,0x69,0x6e,0x2e,
+    0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
-#if !defined(SOKOL_GFX_INCLUDED)
-  #error "Please include sokol_gfx.h before texture.glsl.h"
-#endif
-static inline const sg_shader_desc* texture_program_shader_desc(sg_backend backend) {
-  if (backend == SG_BACKEND_GLCORE33) {
-    static sg_shader_desc desc;
-    static bool valid;
-    if (!valid) {
-      valid = true;
-      desc.attrs[0].name = "position";
-      desc.attrs[1].name = "texcoord";
-      desc.attrs[2].name = "color";
-      desc.vs.source = texture_vs_source_glsl330;
-      desc.vs.entry = "main";
-      desc.fs.source = texture_fs_source_glsl330;
-      desc.fs.entry = "main";
-      desc.fs.images[0].name = "tex";
-      desc.fs.images[0].image_type = SG_IMAGETYPE_2D;
-      desc.fs.images[0].sampler_type = SG_SAMPLERTYPE_FLOAT;
-      desc.label = "texture_program_shader";
-    }
-    return &desc;
-  }
-  if (backend == SG_BACKEND_D3D11) {
-    static sg_shader_desc desc;
-    static bool valid;
-    if (!valid) {
-      valid = true;
-      desc.attrs[0].sem_name = "TEXCOORD";
-      desc.attrs[0].sem_index = 0;
-      desc.attrs[1].sem_name = "TEXCOORD";
-      desc.attrs[1].sem_index = 1;
-      desc.attrs[2].sem_name = "TEXCOORD";
-      desc.attrs[2].sem_index = 2;
-      desc.vs.source = texture_vs_source_hlsl5;
-      desc.vs.d3d11_target = "vs_5_0";
-      desc.vs.entry = "main";
-      desc.fs.source = texture_fs_source_hlsl5;
-      desc.fs.d3d11_target = "ps_5_0";
-      desc.fs.entry = "main";
-      desc.fs.images[0].name = "tex";
-      desc.fs.images[0].image_type = SG_IMAGETYPE_2D;
-      desc.fs.images[0].sampler_type = SG_SAMPLERTYPE_FLOAT;
-      desc.label = "texture_program_shader";
+/*
+    #version 330
+    
+    uniform vec4 vs_params[2];
+    layout(location = 1) in vec4 rect;
+    layout(location = 0) in vec2 corner;
+    layout(location = 4) in float rotation;
+    out vec2 uv;
+    layout(location = 2) in vec4 clip;
+    out vec4 col;
+    layout(location = 3) in vec4 color;
+    layout(location = 5) in float depth;
+    
+    void main()
+    {
+        vec2 _18 = rect.zw;
+        vec2 _26 = (corner - vec2(0.5)) * _18;
+        float _30 = sin(rotation);
+        float _33 = cos(rotation);
+        vec3 _74 = vec3((rect.xy + (_18 * 0.5)) + vec2((_26.x * _33) - (_26.y * _30), (_26.x * _30) + (_26.y * _33)), 1.0);
+        gl_Position = vec4(dot(vs_params[0].xyz, _74), dot(vs_params[1].xyz, _74), depth, 1.0);
+        uv = mix(clip.xy, clip.zw, corner);
+        col = color;
     }
-    return &desc;
-  }
-  if (backend == SG_BACKEND_METAL_MACOS) {
-    static sg_shader_desc desc;
+    
+*/
+static const char sprite_vs_source_glsl330[705] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,
+    0x20,0x76,0x65,0x63,0x34,0x20,0x72,0x65,0x63,0x74,0x3b,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,
+    0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x63,0x6f,0x72,0x6e,0x65,0x72,0x3b,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x34,0x29,0x20,0x69,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,
+    0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,
+    0x32,0x20,0x75,0x76,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,
+    0x63,0x34,0x20,0x63,0x6c,0x69,0x70,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x63,0x6f,0x6c,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x33,0x29,0x20,0x69,0x6e,0x20,0x76,
+    0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,
+    0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x35,0x29,0x20,
+    0x69,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x65,0x70,0x74,0x68,0x3b,0x0a,
+    0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x31,0x38,0x20,0x3d,0x20,0x72,0x65,
+    0x63,0x74,0x2e,0x7a,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x5f,0x32,0x36,0x20,0x3d,0x20,0x28,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x2d,0x20,
+    0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x35,0x29,0x29,0x20,0x2a,0x20,0x5f,0x31,0x38,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x30,0x20,
+    0x3d,0x20,0x73,0x69,0x6e,0x28,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x33,0x20,0x3d,
+    0x20,0x63,0x6f,0x73,0x28,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x5f,0x37,0x34,0x20,0x3d,0x20,0x76,
+    0x65,0x63,0x33,0x28,0x28,0x72,0x65,0x63,0x74,0x2e,0x78,0x79,0x20,0x2b,0x20,0x28,
+    0x5f,0x31,0x38,0x20,0x2a,0x20,0x30,0x2e,0x35,0x29,0x29,0x20,0x2b,0x20,0x76,0x65,
+    0x63,0x32,0x28,0x28,0x5f,0x32,0x36,0x2e,0x78,0x20,0x2a,0x20,0x5f,0x33,0x33,0x29,
+    0x20,0x2d,0x20,0x28,0x5f,0x32,0x36,0x2e,0x79,0x20,0x2a,0x20,0x5f,0x33,0x30,0x29,
+    0x2c,0x20,0x28,0x5f,0x32,0x36,0x2e,0x78,0x20,0x2a,0x20,0x5f,0x33,0x30,0x29,0x20,
+    0x2b,0x20,0x28,0x5f,0x32,0x36,0x2e,0x79,0x20,0x2a,0x20,0x5f,0x33,0x33,0x29,0x29,
+    0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x64,
+    0x6f,0x74,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,
+    0x78,0x79,0x7a,0x2c,0x20,0x5f,0x37,0x34,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x78,0x79,0x7a,0x2c,
+    0x20,0x5f,0x37,0x34,0x29,0x2c,0x20,0x64,0x65,0x70,0x74,0x68,0x2c,0x20,0x31,0x2e,
+    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x6d,0x69,0x78,
+    0x28,0x63,0x6c,0x69,0x70,0x2e,0x78,0x79,0x2c,0x20,0x63,0x6c,0x69,0x70,0x2e,0x7a,
+    0x77,0x2c,0x20,0x63,0x6f,0x72,0x6e,0x65,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x63,0x6f,0x6c,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x00,
+};
+/*
+    cbuffer vs_params : register(b0)
+    {
+        float4 _86_transform_x : packoffset(c0);
+        float4 _86_transform_y : packoffset(c1);
+    };
+    
+    
+    static float4 gl_Position;
+    static float4 rect;
+    static float2 corner;
+    static float rotation;
+    static float2 uv;
+    static float4 clip;
+    static float4 col;
+    static float4 color;
+    static float depth;
+    
+    struct SPIRV_Cross_Input
+    {
+        float2 corner : TEXCOORD0;
+        float4 rect : TEXCOORD1;
+        float4 clip : TEXCOORD2;
+        float4 color : TEXCOORD3;
+        float rotation : TEXCOORD4;
+        float depth : TEXCOORD5;
+    };
+    
+    struct SPIRV_Cross_Output
+    {
+        float2 uv : TEXCOORD0;
+        float4 col : TEXCOORD1;
+        float4 gl_Position : SV_Position;
+    };
+    
+    #line 61 "assets/texture.glsl"
+    void vert_main()
+    {
+    #line 61 "assets/texture.glsl"
+        float2 _18 = rect.zw;
+    #line 62 "assets/texture.glsl"
+        float2 _26 = (corner - 0.5f.xx) * _18;
+    #line 63 "assets/texture.glsl"
+        float _30 = sin(rotation);
+    #line 64 "assets/texture.glsl"
+        float _33 = cos(rotation);
+    #line 65 "assets/texture.glsl"
+        float3 _74 = float3((rect.xy + (_18 * 0.5f)) + float2((_26.x * _33) - (_26.y * _30), (_26.x * _30) + (_26.y * _33)), 1.0f);
+    #line 66 "assets/texture.glsl"
+        gl_Position = float4(dot(_86_transform_x.xyz, _74), dot(_86_transform_y.xyz, _74), depth, 1.0f);
+    #line 67 "assets/texture.glsl"
+        uv = lerp(clip.xy, clip.zw, corner);
+    #line 68 "assets/texture.glsl"
+        col = color;
+    }
+    
+    SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
+    {
+        rect = stage_input.rect;
+        corner = stage_input.corner;
+        rotation = stage_input.rotation;
+        clip = stage_input.clip;
+        color = stage_input.color;
+        depth = stage_input.depth;
+        vert_main();
+        SPIRV_Cross_Output stage_output;
+        stage_output.gl_Position = gl_Position;
+        stage_output.uv = uv;
+        stage_output.col = col;
+        return stage_output;
+    }
+*/
+static const char sprite_vs_source_hlsl5[1803] = {
+    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x30,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x38,
+    0x36,0x5f,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,0x78,0x20,0x3a,0x20,
+    0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x38,0x36,0x5f,0x74,
+    0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,0x79,0x20,0x3a,0x20,0x70,0x61,0x63,
+    0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x31,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,
+    0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,
+    0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x72,0x65,0x63,0x74,0x3b,
+    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x63,
+    0x6f,0x72,0x6e,0x65,0x72,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,
+    0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x3b,0x0a,
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6c,
+    0x69,0x70,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x63,0x6f,0x6c,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x73,0x74,0x61,0x74,
+    0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x65,0x70,0x74,0x68,0x3b,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,
+    0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x3a,0x20,
+    0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x72,0x65,0x63,0x74,0x20,0x3a,0x20,0x54,0x45,0x58,
+    0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x63,0x6c,0x69,0x70,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,
+    0x52,0x44,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,
+    0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x6f,0x74,
+    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,
+    0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x65,0x70,
+    0x74,0x68,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x35,0x3b,0x0a,
+    0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,
+    0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x20,0x3a,0x20,
+    0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,
+    0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,
+    0x53,0x56,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x7d,0x3b,0x0a,
+    0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x36,0x31,0x20,0x22,0x61,0x73,0x73,0x65,0x74,
+    0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,
+    0x76,0x6f,0x69,0x64,0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,
+    0x0a,0x7b,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x36,0x31,0x20,0x22,0x61,0x73,0x73,
+    0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,
+    0x22,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x31,0x38,
+    0x20,0x3d,0x20,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x3b,0x0a,0x23,0x6c,0x69,0x6e,
+    0x65,0x20,0x36,0x32,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x32,0x36,0x20,0x3d,0x20,0x28,0x63,0x6f,0x72,
+    0x6e,0x65,0x72,0x20,0x2d,0x20,0x30,0x2e,0x35,0x66,0x2e,0x78,0x78,0x29,0x20,0x2a,
+    0x20,0x5f,0x31,0x38,0x3b,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x36,0x33,0x20,0x22,
+    0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,
+    0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,
+    0x33,0x30,0x20,0x3d,0x20,0x73,0x69,0x6e,0x28,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,
+    0x6e,0x29,0x3b,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x36,0x34,0x20,0x22,0x61,0x73,
+    0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,
+    0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x33,
+    0x20,0x3d,0x20,0x63,0x6f,0x73,0x28,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x29,
+    0x3b,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x36,0x35,0x20,0x22,0x61,0x73,0x73,0x65,
+    0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x37,0x34,0x20,
+    0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x28,0x72,0x65,0x63,0x74,0x2e,0x78,
+    0x79,0x20,0x2b,0x20,0x28,0x5f,0x31,0x38,0x20,0x2a,0x20,0x30,0x2e,0x35,0x66,0x29,
+    0x29,0x20,0x2b,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x28,0x5f,0x32,0x36,0x2e,
+    0x78,0x20,0x2a,0x20,0x5f,0x33,0x33,0x29,0x20,0x2d,0x20,0x28,0x5f,0x32,0x36,0x2e,
+    0x79,0x20,0x2a,0x20,0x5f,0x33,0x30,0x29,0x2c,0x20,0x28,0x5f,0x32,0x36,0x2e,0x78,
+    0x20,0x2a,0x20,0x5f,0x33,0x30,0x29,0x20,0x2b,0x20,0x28,0x5f,0x32,0x36,0x2e,0x79,
+    0x20,0x2a,0x20,0x5f,0x33,0x33,0x29,0x29,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,
+    0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x36,0x36,0x20,0x22,0x61,0x73,0x73,0x65,0x74,
+    0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,
+    0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x64,0x6f,0x74,0x28,0x5f,0x38,0x36,
+    0x5f,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,0x78,0x2e,0x78,0x79,0x7a,
+    0x2c,0x20,0x5f,0x37,0x34,0x29,0x2c,0x20,0x64,0x6f,0x74,0x28,0x5f,0x38,0x36,0x5f,
+    0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,0x79,0x2e,0x78,0x79,0x7a,0x2c,
+    0x20,0x5f,0x37,0x34,0x29,0x2c,0x20,0x64,0x65,0x70,0x74,0x68,0x2c,0x20,0x31,0x2e,
+    0x30,0x66,0x29,0x3b,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x36,0x37,0x20,0x22,0x61,
+    0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,
+    0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x6c,0x65,0x72,
+    0x70,0x28,0x63,0x6c,0x69,0x70,0x2e,0x78,0x79,0x2c,0x20,0x63,0x6c,0x69,0x70,0x2e,
+    0x7a,0x77,0x2c,0x20,0x63,0x6f,0x72,0x6e,0x65,0x72,0x29,0x3b,0x0a,0x23,0x6c,0x69,
+    0x6e,0x65,0x20,0x36,0x38,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,
+    0x63,0x6f,0x6c,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,
+    0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,
+    0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x63,
+    0x74,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,
+    0x72,0x65,0x63,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x72,0x6e,0x65,0x72,
+    0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x63,
+    0x6f,0x72,0x6e,0x65,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x6f,0x74,0x61,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,
+    0x74,0x2e,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x63,0x6c,0x69,0x70,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,
+    0x75,0x74,0x2e,0x63,0x6c,0x69,0x70,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,
+    0x6f,0x72,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,
+    0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x64,0x65,0x70,0x74,
+    0x68,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,
+    0x64,0x65,0x70,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x72,0x74,0x5f,
+    0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,
+    0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x67,0x6c,
+    0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x67,0x6c,0x5f,0x50,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x75,0x76,0x20,0x3d,0x20,0x75,
+    0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,
+    0x70,0x75,0x74,0x2e,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+    
+    using namespace metal;
+    
+    struct vs_params
+    {
+        float4 transform_x;
+        float4 transform_y;
+    };
+    
+    struct main0_out
+    {
+        float2 uv [[user(locn0)]];
+        float4 col [[user(locn1)]];
+        float4 gl_Position [[position]];
+    };
+    
+    struct main0_in
+    {
+        float2 corner [[attribute(0)]];
+        float4 rect [[attribute(1)]];
+        float4 clip [[attribute(2)]];
+        float4 color [[attribute(3)]];
+        float rotation [[attribute(4)]];
+        float depth [[attribute(5)]];
+    };
+    
+    #line 61 "assets/texture.glsl"
+    vertex main0_out main0(main0_in in [[stage_in]], constant vs_params& _86 [[buffer(0)]])
+    {
+        main0_out out = {};
+    #line 61 "assets/texture.glsl"
+        float2 _18 = in.rect.zw;
+    #line 62 "assets/texture.glsl"
+        float2 _26 = (in.corner - float2(0.5)) * _18;
+    #line 63 "assets/texture.glsl"
+        float _30 = sin(in.rotation);
+    #line 64 "assets/texture.glsl"
+        float _33 = cos(in.rotation);
+    #line 65 "assets/texture.glsl"
+        float3 _74 = float3((in.rect.xy + (_18 * 0.5)) + float2((_26.x * _33) - (_26.y * _30), (_26.x * _30) + (_26.y * _33)), 1.0);
+    #line 66 "assets/texture.glsl"
+        out.gl_Position = float4(dot(_86.transform_x.xyz, _74), dot(_86.transform_y.xyz, _74), in.depth, 1.0);
+    #line 67 "assets/texture.glsl"
+        out.uv = mix(in.clip.xy, in.clip.zw, in.corner);
+    #line 68 "assets/texture.glsl"
+        out.col = in.color;
+        return out;
+    }
+    
+*/
+static const char sprite_vs_source_metal_macos[1371] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,
+    0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x74,0x72,
+    0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,0x79,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,
+    0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x20,
+    0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x20,
+    0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x70,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,
+    0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x5b,0x5b,
+    0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x72,0x65,0x63,0x74,0x20,
+    0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x31,0x29,0x5d,0x5d,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6c,0x69,
+    0x70,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x32,0x29,
+    0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,
+    0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+    0x28,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,
+    0x69,0x62,0x75,0x74,0x65,0x28,0x34,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x65,0x70,0x74,0x68,0x20,0x5b,0x5b,0x61,0x74,
+    0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x35,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x36,0x31,0x20,0x22,0x61,0x73,0x73,0x65,
+    0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,
+    0x0a,0x76,0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,
+    0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,
+    0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,
+    0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x38,0x36,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,
+    0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,
+    0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,
+    0x7d,0x3b,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x36,0x31,0x20,0x22,0x61,0x73,0x73,
+    0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,
+    0x22,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x31,0x38,
+    0x20,0x3d,0x20,0x69,0x6e,0x2e,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x3b,0x0a,0x23,
+    0x6c,0x69,0x6e,0x65,0x20,0x36,0x32,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x32,0x36,0x20,0x3d,0x20,0x28,
+    0x69,0x6e,0x2e,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x2d,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x28,0x30,0x2e,0x35,0x29,0x29,0x20,0x2a,0x20,0x5f,0x31,0x38,0x3b,0x0a,
+    0x23,0x6c,0x69,0x6e,0x65,0x20,0x36,0x33,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,
+    0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x30,0x20,0x3d,0x20,0x73,
+    0x69,0x6e,0x28,0x69,0x6e,0x2e,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x29,0x3b,
+    0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x36,0x34,0x20,0x22,0x61,0x73,0x73,0x65,0x74,
+    0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x33,0x33,0x20,0x3d,0x20,
+    0x63,0x6f,0x73,0x28,0x69,0x6e,0x2e,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x29,
+    0x3b,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x36,0x35,0x20,0x22,0x61,0x73,0x73,0x65,
+    0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x37,0x34,0x20,
+    0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x28,0x69,0x6e,0x2e,0x72,0x65,0x63,
+    0x74,0x2e,0x78,0x79,0x20,0x2b,0x20,0x28,0x5f,0x31,0x38,0x20,0x2a,0x20,0x30,0x2e,
+    0x35,0x29,0x29,0x20,0x2b,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x28,0x5f,0x32,
+    0x36,0x2e,0x78,0x20,0x2a,0x20,0x5f,0x33,0x33,0x29,0x20,0x2d,0x20,0x28,0x5f,0x32,
+    0x36,0x2e,0x79,0x20,0x2a,0x20,0x5f,0x33,0x30,0x29,0x2c,0x20,0x28,0x5f,0x32,0x36,
+    0x2e,0x78,0x20,0x2a,0x20,0x5f,0x33,0x30,0x29,0x20,0x2b,0x20,0x28,0x5f,0x32,0x36,
+    0x2e,0x79,0x20,0x2a,0x20,0x5f,0x33,0x33,0x29,0x29,0x2c,0x20,0x31,0x2e,0x30,0x29,
+    0x3b,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x36,0x36,0x20,0x22,0x61,0x73,0x73,0x65,
+    0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,
+    0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x64,0x6f,
+    0x74,0x28,0x5f,0x38,0x36,0x2e,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,
+    0x78,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x5f,0x37,0x34,0x29,0x2c,0x20,0x64,0x6f,0x74,
+    0x28,0x5f,0x38,0x36,0x2e,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,0x79,
+    0x2e,0x78,0x79,0x7a,0x2c,0x20,0x5f,0x37,0x34,0x29,0x2c,0x20,0x69,0x6e,0x2e,0x64,
+    0x65,0x70,0x74,0x68,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x23,0x6c,0x69,0x6e,
+    0x65,0x20,0x36,0x37,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x6f,
+    0x75,0x74,0x2e,0x75,0x76,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x69,0x6e,0x2e,0x63,
+    0x6c,0x69,0x70,0x2e,0x78,0x79,0x2c,0x20,0x69,0x6e,0x2e,0x63,0x6c,0x69,0x70,0x2e,
+    0x7a,0x77,0x2c,0x20,0x69,0x6e,0x2e,0x63,0x6f,0x72,0x6e,0x65,0x72,0x29,0x3b,0x0a,
+    0x23,0x6c,0x69,0x6e,0x65,0x20,0x36,0x38,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,
+    0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,
+    0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x69,0x6e,0x2e,
+    0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 330
+    
+    uniform vec4 vs_params[2];
+    layout(location = 0) in vec2 position;
+    out vec2 uv;
+    layout(location = 1) in vec2 texcoord;
+    out vec4 col;
+    layout(location = 2) in vec4 color;
+    flat out float tex_index;
+    layout(location = 3) in float slot;
+    layout(location = 4) in float depth;
+    
+    void main()
+    {
+        vec3 _23 = vec3(position, 1.0);
+        gl_Position = vec4(dot(vs_params[0].xyz, _23), dot(vs_params[1].xyz, _23), depth, 1.0);
+        uv = texcoord;
+        col = color;
+        tex_index = slot;
+    }
+    
+*/
+static const char multi_vs_source_glsl330[486] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,
+    0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x3b,0x0a,0x6c,0x61,0x79,
+    0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,
+    0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x74,0x65,0x78,0x63,0x6f,0x6f,
+    0x72,0x64,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,
+    0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x63,
+    0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x66,0x6c,0x61,0x74,0x20,0x6f,0x75,0x74,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x74,0x65,0x78,0x5f,0x69,0x6e,0x64,0x65,0x78,0x3b,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x33,0x29,0x20,0x69,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x6c,
+    0x6f,0x74,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x34,0x29,0x20,0x69,0x6e,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x64,0x65,0x70,0x74,0x68,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,
+    0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,
+    0x20,0x5f,0x32,0x33,0x20,0x3d,0x20,0x76,0x65,0x63,0x33,0x28,0x70,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,
+    0x63,0x34,0x28,0x64,0x6f,0x74,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x30,0x5d,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x5f,0x32,0x33,0x29,0x2c,0x20,0x64,
+    0x6f,0x74,0x28,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,
+    0x78,0x79,0x7a,0x2c,0x20,0x5f,0x32,0x33,0x29,0x2c,0x20,0x64,0x65,0x70,0x74,0x68,
+    0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x20,0x3d,
+    0x20,0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,
+    0x6f,0x6c,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x74,0x65,0x78,0x5f,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x20,0x73,0x6c,0x6f,0x74,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 330
+    
+    uniform vec4 fs_params[1];
+    uniform sampler2D tex0;
+    uniform sampler2D tex1;
+    uniform sampler2D tex2;
+    uniform sampler2D tex3;
+    
+    in vec2 uv;
+    flat in float tex_index;
+    layout(location = 0) out vec4 fragColor;
+    in vec4 col;
+    
+    void main()
+    {
+        vec2 _12 = dFdx(uv);
+        vec2 _15 = dFdy(uv);
+        vec4 c;
+        if (tex_index < 0.5)
+        {
+            c = textureGrad(tex0, uv, _12, _15);
+        }
+        else
+        {
+            if (tex_index < 1.5)
+            {
+                c = textureGrad(tex1, uv, _12, _15);
+            }
+            else
+            {
+                if (tex_index < 2.5)
+                {
+                    c = textureGrad(tex2, uv, _12, _15);
+                }
+                else
+                {
+                    c = textureGrad(tex3, uv, _12, _15);
+                }
+            }
+        }
+        if (c.w < fs_params[0].x)
+        {
+            discard;
+        }
+        fragColor = c * col;
+    }
+    
+*/
+static const char multi_fs_source_glsl330[840] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,
+    0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x74,0x65,0x78,0x30,0x3b,
+    0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,
+    0x32,0x44,0x20,0x74,0x65,0x78,0x31,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,
+    0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x74,0x65,0x78,0x32,0x3b,
+    0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,
+    0x32,0x44,0x20,0x74,0x65,0x78,0x33,0x3b,0x0a,0x0a,0x69,0x6e,0x20,0x76,0x65,0x63,
+    0x32,0x20,0x75,0x76,0x3b,0x0a,0x66,0x6c,0x61,0x74,0x20,0x69,0x6e,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x74,0x65,0x78,0x5f,0x69,0x6e,0x64,0x65,0x78,0x3b,0x0a,0x6c,
+    0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,
+    0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x72,0x61,
+    0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x63,0x6f,0x6c,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x31,0x32,
+    0x20,0x3d,0x20,0x64,0x46,0x64,0x78,0x28,0x75,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x31,0x35,0x20,0x3d,0x20,0x64,0x46,0x64,0x79,
+    0x28,0x75,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x63,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x65,0x78,0x5f,0x69,0x6e,
+    0x64,0x65,0x78,0x20,0x3c,0x20,0x30,0x2e,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x47,0x72,0x61,0x64,0x28,0x74,0x65,0x78,0x30,0x2c,0x20,0x75,
+    0x76,0x2c,0x20,0x5f,0x31,0x32,0x2c,0x20,0x5f,0x31,0x35,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,
+    0x65,0x78,0x5f,0x69,0x6e,0x64,0x65,0x78,0x20,0x3c,0x20,0x31,0x2e,0x35,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x47,0x72,0x61,0x64,0x28,0x74,0x65,0x78,0x31,0x2c,0x20,0x75,0x76,0x2c,0x20,
+    0x5f,0x31,0x32,0x2c,0x20,0x5f,0x31,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,
+    0x65,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x65,0x78,0x5f,
+    0x69,0x6e,0x64,0x65,0x78,0x20,0x3c,0x20,0x32,0x2e,0x35,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x47,0x72,0x61,0x64,0x28,0x74,0x65,0x78,0x32,0x2c,
+    0x20,0x75,0x76,0x2c,0x20,0x5f,0x31,0x32,0x2c,0x20,0x5f,0x31,0x35,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,
+    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x47,0x72,0x61,0x64,0x28,0x74,0x65,0x78,
+    0x33,0x2c,0x20,0x75,0x76,0x2c,0x20,0x5f,0x31,0x32,0x2c,0x20,0x5f,0x31,0x35,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x63,0x2e,0x77,0x20,0x3c,0x20,0x66,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x63,
+    0x61,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x63,0x20,0x2a,0x20,0x63,
+    0x6f,0x6c,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    cbuffer vs_params : register(b0)
+    {
+        float4 _19_transform_x : packoffset(c0);
+        float4 _19_transform_y : packoffset(c1);
+    };
+    
+    
+    static float4 gl_Position;
+    static float2 position;
+    static float2 uv;
+    static float2 texcoord;
+    static float4 col;
+    static float4 color;
+    static float tex_index;
+    static float slot;
+    static float depth;
+    
+    struct SPIRV_Cross_Input
+    {
+        float2 position : TEXCOORD0;
+        float2 texcoord : TEXCOORD1;
+        float4 color : TEXCOORD2;
+        float slot : TEXCOORD3;
+        float depth : TEXCOORD4;
+    };
+    
+    struct SPIRV_Cross_Output
+    {
+        float2 uv : TEXCOORD0;
+        float4 col : TEXCOORD1;
+        nointerpolation float tex_index : TEXCOORD2;
+        float4 gl_Position : SV_Position;
+    };
+    
+    #line 89 "assets/texture.glsl"
+    void vert_main()
+    {
+    #line 89 "assets/texture.glsl"
+        float3 _23 = float3(position, 1.0f);
+    #line 90 "assets/texture.glsl"
+        gl_Position = float4(dot(_19_transform_x.xyz, _23), dot(_19_transform_y.xyz, _23), depth, 1.0f);
+    #line 91 "assets/texture.glsl"
+        uv = texcoord;
+    #line 92 "assets/texture.glsl"
+        col = color;
+    #line 93 "assets/texture.glsl"
+        tex_index = slot;
+    }
+    
+    SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
+    {
+        position = stage_input.position;
+        texcoord = stage_input.texcoord;
+        color = stage_input.color;
+        slot = stage_input.slot;
+        depth = stage_input.depth;
+        vert_main();
+        SPIRV_Cross_Output stage_output;
+        stage_output.gl_Position = gl_Position;
+        stage_output.uv = uv;
+        stage_output.col = col;
+        stage_output.tex_index = tex_index;
+        return stage_output;
+    }
+*/
+static const char multi_vs_source_hlsl5[1535] = {
+    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x30,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,
+    0x39,0x5f,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,0x78,0x20,0x3a,0x20,
+    0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x31,0x39,0x5f,0x74,
+    0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,0x79,0x20,0x3a,0x20,0x70,0x61,0x63,
+    0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x31,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,
+    0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,
+    0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x75,0x76,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,
+    0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x74,0x65,0x78,0x5f,0x69,0x6e,0x64,0x65,0x78,0x3b,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x6c,0x6f,0x74,
+    0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,
+    0x65,0x70,0x74,0x68,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,
+    0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,
+    0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,
+    0x78,0x63,0x6f,0x6f,0x72,0x64,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,
+    0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,
+    0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x32,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x6c,0x6f,0x74,
+    0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x33,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x65,0x70,0x74,0x68,0x20,0x3a,0x20,
+    0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x34,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,
+    0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,
+    0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,
+    0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x63,0x6f,0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6e,0x6f,0x69,0x6e,0x74,0x65,0x72,0x70,0x6f,0x6c,
+    0x61,0x74,0x69,0x6f,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x65,0x78,0x5f,
+    0x69,0x6e,0x64,0x65,0x78,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,
+    0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,
+    0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x53,0x56,0x5f,0x50,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x23,0x6c,0x69,
+    0x6e,0x65,0x20,0x38,0x39,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x76,0x6f,0x69,0x64,
+    0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x23,
+    0x6c,0x69,0x6e,0x65,0x20,0x38,0x39,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x5f,0x32,0x33,0x20,0x3d,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x28,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,
+    0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x39,0x30,0x20,
+    0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,
+    0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x64,
+    0x6f,0x74,0x28,0x5f,0x31,0x39,0x5f,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,
+    0x5f,0x78,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x5f,0x32,0x33,0x29,0x2c,0x20,0x64,0x6f,
+    0x74,0x28,0x5f,0x31,0x39,0x5f,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,
+    0x79,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x5f,0x32,0x33,0x29,0x2c,0x20,0x64,0x65,0x70,
+    0x74,0x68,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x23,0x6c,0x69,0x6e,0x65,
+    0x20,0x39,0x31,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,
+    0x20,0x3d,0x20,0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x23,0x6c,0x69,
+    0x6e,0x65,0x20,0x39,0x32,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,
+    0x63,0x6f,0x6c,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x23,0x6c,0x69,
+    0x6e,0x65,0x20,0x39,0x33,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,
+    0x74,0x65,0x78,0x5f,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x20,0x73,0x6c,0x6f,0x74,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,
+    0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,
+    0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,0x64,0x20,
+    0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x74,0x65,
+    0x78,0x63,0x6f,0x6f,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,
+    0x72,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,
+    0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x6c,0x6f,0x74,0x20,
+    0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x73,0x6c,
+    0x6f,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x64,0x65,0x70,0x74,0x68,0x20,0x3d,0x20,
+    0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x64,0x65,0x70,0x74,
+    0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,
+    0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,
+    0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,
+    0x75,0x74,0x70,0x75,0x74,0x2e,0x75,0x76,0x20,0x3d,0x20,0x75,0x76,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,
+    0x63,0x6f,0x6c,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x74,0x65,0x78,0x5f,
+    0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x20,0x74,0x65,0x78,0x5f,0x69,0x6e,0x64,0x65,
+    0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,
+    0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+/*
+    cbuffer fs_params : register(b0)
+    {
+        float _83_alpha_cutoff : packoffset(c0);
+    };
+    
+    Texture2D<float4> tex0 : register(t0);
+    SamplerState _tex0_sampler : register(s0);
+    Texture2D<float4> tex1 : register(t1);
+    SamplerState _tex1_sampler : register(s1);
+    Texture2D<float4> tex2 : register(t2);
+    SamplerState _tex2_sampler : register(s2);
+    Texture2D<float4> tex3 : register(t3);
+    SamplerState _tex3_sampler : register(s3);
+    
+    static float2 uv;
+    static float tex_index;
+    static float4 fragColor;
+    static float4 col;
+    
+    struct SPIRV_Cross_Input
+    {
+        float2 uv : TEXCOORD0;
+        float4 col : TEXCOORD1;
+        nointerpolation float tex_index : TEXCOORD2;
+    };
+    
+    struct SPIRV_Cross_Output
+    {
+        float4 fragColor : SV_Target0;
+    };
+    
+    #line 114 "assets/texture.glsl"
+    void frag_main()
+    {
+    #line 114 "assets/texture.glsl"
+        float2 _12 = ddx(uv);
+    #line 115 "assets/texture.glsl"
+        float2 _15 = ddy(uv);
+    #line 117 "assets/texture.glsl"
+        float4 c;
+        if (tex_index < 0.5f)
+        {
+    #line 118 "assets/texture.glsl"
+            c = tex0.SampleGrad(_tex0_sampler, uv, _12, _15);
+        }
+        else
+        {
+    #line 119 "assets/texture.glsl"
+            if (tex_index < 1.5f)
+            {
+    #line 120 "assets/texture.glsl"
+                c = tex1.SampleGrad(_tex1_sampler, uv, _12, _15);
+            }
+            else
+            {
+    #line 121 "assets/texture.glsl"
+                if (tex_index < 2.5f)
+                {
+    #line 122 "assets/texture.glsl"
+                    c = tex2.SampleGrad(_tex2_sampler, uv, _12, _15);
+                }
+                else
+                {
+    #line 124 "assets/texture.glsl"
+                    c = tex3.SampleGrad(_tex3_sampler, uv, _12, _15);
+                }
+            }
+        }
+    #line 125 "assets/texture.glsl"
+        if (c.w < _83_alpha_cutoff)
+        {
+    #line 126 "assets/texture.glsl"
+            discard;
+        }
+    #line 127 "assets/texture.glsl"
+        fragColor = c * col;
+    }
+    
+    SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
+    {
+        uv = stage_input.uv;
+        tex_index = stage_input.tex_index;
+        col = stage_input.col;
+        frag_main();
+        SPIRV_Cross_Output stage_output;
+        stage_output.fragColor = fragColor;
+        return stage_output;
+    }
+*/
+static const char multi_fs_source_hlsl5[2063] = {
+    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x30,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x38,0x33,
+    0x5f,0x61,0x6c,0x70,0x68,0x61,0x5f,0x63,0x75,0x74,0x6f,0x66,0x66,0x20,0x3a,0x20,
+    0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,
+    0x7d,0x3b,0x0a,0x0a,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x3e,0x20,0x74,0x65,0x78,0x30,0x20,0x3a,0x20,0x72,0x65,0x67,
+    0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x30,0x29,0x3b,0x0a,0x53,0x61,0x6d,0x70,0x6c,
+    0x65,0x72,0x53,0x74,0x61,0x74,0x65,0x20,0x5f,0x74,0x65,0x78,0x30,0x5f,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,
+    0x28,0x73,0x30,0x29,0x3b,0x0a,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x3c,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,0x74,0x65,0x78,0x31,0x20,0x3a,0x20,0x72,
+    0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x31,0x29,0x3b,0x0a,0x53,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x53,0x74,0x61,0x74,0x65,0x20,0x5f,0x74,0x65,0x78,0x31,0x5f,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,
+    0x65,0x72,0x28,0x73,0x31,0x29,0x3b,0x0a,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x32,
+    0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,0x74,0x65,0x78,0x32,0x20,0x3a,
+    0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x32,0x29,0x3b,0x0a,0x53,
+    0x61,0x6d,0x70,0x6c,0x65,0x72,0x53,0x74,0x61,0x74,0x65,0x20,0x5f,0x74,0x65,0x78,
+    0x32,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,
+    0x73,0x74,0x65,0x72,0x28,0x73,0x32,0x29,0x3b,0x0a,0x54,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,0x74,0x65,0x78,0x33,
+    0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x33,0x29,0x3b,
+    0x0a,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x53,0x74,0x61,0x74,0x65,0x20,0x5f,0x74,
+    0x65,0x78,0x33,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x3a,0x20,0x72,0x65,
+    0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x73,0x33,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x61,
+    0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x3b,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x65,0x78,0x5f,
+    0x69,0x6e,0x64,0x65,0x78,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,
+    0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,
+    0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x20,0x3a,0x20,0x54,
+    0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,
+    0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6e,0x6f,0x69,0x6e,0x74,0x65,
+    0x72,0x70,0x6f,0x6c,0x61,0x74,0x69,0x6f,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x74,0x65,0x78,0x5f,0x69,0x6e,0x64,0x65,0x78,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,
+    0x4f,0x4f,0x52,0x44,0x32,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,
+    0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,
+    0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3a,0x20,0x53,0x56,
+    0x5f,0x54,0x61,0x72,0x67,0x65,0x74,0x30,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x23,0x6c,
+    0x69,0x6e,0x65,0x20,0x31,0x31,0x34,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x76,0x6f,
+    0x69,0x64,0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,
+    0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x31,0x31,0x34,0x20,0x22,0x61,0x73,0x73,0x65,
+    0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x31,0x32,0x20,
+    0x3d,0x20,0x64,0x64,0x78,0x28,0x75,0x76,0x29,0x3b,0x0a,0x23,0x6c,0x69,0x6e,0x65,
+    0x20,0x31,0x31,0x35,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x31,0x35,0x20,0x3d,0x20,0x64,0x64,0x79,0x28,
+    0x75,0x76,0x29,0x3b,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x31,0x31,0x37,0x20,0x22,
+    0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,
+    0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x65,0x78,0x5f,0x69,
+    0x6e,0x64,0x65,0x78,0x20,0x3c,0x20,0x30,0x2e,0x35,0x66,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x31,0x31,0x38,0x20,0x22,0x61,0x73,
+    0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,
+    0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x74,
+    0x65,0x78,0x30,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x47,0x72,0x61,0x64,0x28,0x5f,
+    0x74,0x65,0x78,0x30,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x75,0x76,
+    0x2c,0x20,0x5f,0x31,0x32,0x2c,0x20,0x5f,0x31,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x31,0x31,0x39,0x20,0x22,0x61,0x73,0x73,
+    0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,
+    0x22,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x65,
+    0x78,0x5f,0x69,0x6e,0x64,0x65,0x78,0x20,0x3c,0x20,0x31,0x2e,0x35,0x66,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,
+    0x31,0x32,0x30,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x74,0x65,0x78,0x31,0x2e,0x53,
+    0x61,0x6d,0x70,0x6c,0x65,0x47,0x72,0x61,0x64,0x28,0x5f,0x74,0x65,0x78,0x31,0x5f,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x75,0x76,0x2c,0x20,0x5f,0x31,0x32,
+    0x2c,0x20,0x5f,0x31,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x31,
+    0x32,0x31,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x74,0x65,0x78,0x5f,0x69,0x6e,0x64,
+    0x65,0x78,0x20,0x3c,0x20,0x32,0x2e,0x35,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x31,
+    0x32,0x32,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x74,0x65,0x78,
+    0x32,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x47,0x72,0x61,0x64,0x28,0x5f,0x74,0x65,
+    0x78,0x32,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x75,0x76,0x2c,0x20,
+    0x5f,0x31,0x32,0x2c,0x20,0x5f,0x31,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x31,0x32,
+    0x34,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x74,0x65,0x78,0x33,
+    0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x47,0x72,0x61,0x64,0x28,0x5f,0x74,0x65,0x78,
+    0x33,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x75,0x76,0x2c,0x20,0x5f,
+    0x31,0x32,0x2c,0x20,0x5f,0x31,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x31,0x32,
+    0x35,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x63,0x2e,0x77,0x20,0x3c,0x20,0x5f,0x38,0x33,0x5f,0x61,0x6c,0x70,0x68,0x61,0x5f,
+    0x63,0x75,0x74,0x6f,0x66,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x23,0x6c,
+    0x69,0x6e,0x65,0x20,0x31,0x32,0x36,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x31,0x32,0x37,0x20,0x22,
+    0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,
+    0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,
+    0x6f,0x72,0x20,0x3d,0x20,0x63,0x20,0x2a,0x20,0x63,0x6f,0x6c,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,
+    0x70,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,
+    0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,
+    0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x75,
+    0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x5f,0x69,0x6e,0x64,0x65,0x78,
+    0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x74,
+    0x65,0x78,0x5f,0x69,0x6e,0x64,0x65,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,
+    0x6c,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,
+    0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,
+    0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,
+    0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,
+    0x43,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,
+    0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,
+    0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+    
+    using namespace metal;
+    
+    struct vs_params
+    {
+        float4 transform_x;
+        float4 transform_y;
+    };
+    
+    struct main0_out
+    {
+        float2 uv [[user(locn0)]];
+        float4 col [[user(locn1)]];
+        float tex_index [[user(locn2)]];
+        float4 gl_Position [[position]];
+    };
+    
+    struct main0_in
+    {
+        float2 position [[attribute(0)]];
+        float2 texcoord [[attribute(1)]];
+        float4 color [[attribute(2)]];
+        float slot [[attribute(3)]];
+        float depth [[attribute(4)]];
+    };
+    
+    #line 89 "assets/texture.glsl"
+    vertex main0_out main0(main0_in in [[stage_in]], constant vs_params& _19 [[buffer(0)]])
+    {
+        main0_out out = {};
+    #line 89 "assets/texture.glsl"
+        float3 _23 = float3(in.position, 1.0);
+    #line 90 "assets/texture.glsl"
+        out.gl_Position = float4(dot(_19.transform_x.xyz, _23), dot(_19.transform_y.xyz, _23), in.depth, 1.0);
+    #line 91 "assets/texture.glsl"
+        out.uv = in.texcoord;
+    #line 92 "assets/texture.glsl"
+        out.col = in.color;
+    #line 93 "assets/texture.glsl"
+        out.tex_index = in.slot;
+        return out;
+    }
+    
+*/
+static const char multi_vs_source_metal_macos[1052] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x76,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,
+    0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x74,0x72,
+    0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,0x79,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,
+    0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x20,
+    0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x20,
+    0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x65,0x78,0x5f,0x69,
+    0x6e,0x64,0x65,0x78,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,
+    0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x70,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,
+    0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+    0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x74,0x65,0x78,0x63,0x6f,0x6f,0x72,0x64,0x20,0x5b,0x5b,0x61,0x74,0x74,
+    0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x5b,0x5b,
+    0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x32,0x29,0x5d,0x5d,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x6c,0x6f,0x74,0x20,0x5b,
+    0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x33,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x65,0x70,0x74,0x68,
+    0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x34,0x29,0x5d,
+    0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x38,0x39,0x20,
+    0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,
+    0x67,0x6c,0x73,0x6c,0x22,0x0a,0x76,0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,
+    0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,
+    0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,
+    0x76,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x31,0x39,0x20,0x5b,
+    0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,
+    0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x38,0x39,
+    0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x5f,0x32,0x33,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x69,
+    0x6e,0x2e,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x31,0x2e,0x30,0x29,
+    0x3b,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x39,0x30,0x20,0x22,0x61,0x73,0x73,0x65,
+    0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,
+    0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x64,0x6f,
+    0x74,0x28,0x5f,0x31,0x39,0x2e,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,
+    0x78,0x2e,0x78,0x79,0x7a,0x2c,0x20,0x5f,0x32,0x33,0x29,0x2c,0x20,0x64,0x6f,0x74,
+    0x28,0x5f,0x31,0x39,0x2e,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x5f,0x79,
+    0x2e,0x78,0x79,0x7a,0x2c,0x20,0x5f,0x32,0x33,0x29,0x2c,0x20,0x69,0x6e,0x2e,0x64,
+    0x65,0x70,0x74,0x68,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x23,0x6c,0x69,0x6e,
+    0x65,0x20,0x39,0x31,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x6f,
+    0x75,0x74,0x2e,0x75,0x76,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x74,0x65,0x78,0x63,0x6f,
+    0x6f,0x72,0x64,0x3b,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x39,0x32,0x20,0x22,0x61,
+    0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,
+    0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x63,0x6f,0x6c,0x20,
+    0x3d,0x20,0x69,0x6e,0x2e,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x23,0x6c,0x69,0x6e,
+    0x65,0x20,0x39,0x33,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,
+    0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x6f,
+    0x75,0x74,0x2e,0x74,0x65,0x78,0x5f,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x20,0x69,
+    0x6e,0x2e,0x73,0x6c,0x6f,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+    
+    using namespace metal;
+    
+    struct fs_params
+    {
+        float alpha_cutoff;
+    };
+    
+    struct main0_out
+    {
+        float4 fragColor [[color(0)]];
+    };
+    
+    struct main0_in
+    {
+        float2 uv [[user(locn0)]];
+        float4 col [[user(locn1)]];
+        float tex_index [[user(locn2), flat]];
+    };
+    
+    #line 114 "assets/texture.glsl"
+    fragment main0_out main0(main0_in in [[stage_in]], texture2d<float> tex0 [[texture(0)]], texture2d<float> tex1 [[texture(1)]], texture2d<float> tex2 [[texture(2)]], texture2d<float> tex3 [[texture(3)]], constant fs_params& _83 [[buffer(0)]], sampler tex0Smplr [[sampler(0)]], sampler tex1Smplr [[sampler(1)]], sampler tex2Smplr [[sampler(2)]], sampler tex3Smplr [[sampler(3)]])
+    {
+        main0_out out = {};
+    #line 114 "assets/texture.glsl"
+        float2 _12 = dfdx(in.uv);
+    #line 115 "assets/texture.glsl"
+        float2 _15 = dfdy(in.uv);
+    #line 117 "assets/texture.glsl"
+        float4 c;
+        if (in.tex_index < 0.5)
+        {
+    #line 118 "assets/texture.glsl"
+            c = tex0.sample(tex0Smplr, in.uv, gradient2d(_12, _15));
+        }
+        else
+        {
+    #line 119 "assets/texture.glsl"
+            if (in.tex_index < 1.5)
+            {
+    #line 120 "assets/texture.glsl"
+                c = tex1.sample(tex1Smplr, in.uv, gradient2d(_12, _15));
+            }
+            else
+            {
+    #line 121 "assets/texture.glsl"
+                if (in.tex_index < 2.5)
+                {
+    #line 122 "assets/texture.glsl"
+                    c = tex2.sample(tex2Smplr, in.uv, gradient2d(_12, _15));
+                }
+                else
+                {
+    #line 124 "assets/texture.glsl"
+                    c = tex3.sample(tex3Smplr, in.uv, gradient2d(_12, _15));
+                }
+            }
+        }
+    #line 125 "assets/texture.glsl"
+        if (c.w < _83.alpha_cutoff)
+        {
+    #line 126 "assets/texture.glsl"
+            discard_fragment();
+        }
+    #line 127 "assets/texture.glsl"
+        out.fragColor = c * in.col;
+        return out;
+    }
+    
+*/
+static const char multi_fs_source_metal_macos[1858] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,
+    0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x61,0x6c,0x70,0x68,0x61,0x5f,0x63,0x75,0x74,0x6f,0x66,
+    0x66,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,
+    0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,0x5b,
+    0x5b,0x63,0x6f,0x6c,0x6f,0x72,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,
+    0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,
+    0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x65,0x78,0x5f,
+    0x69,0x6e,0x64,0x65,0x78,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,
+    0x6e,0x32,0x29,0x2c,0x20,0x66,0x6c,0x61,0x74,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,
+    0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x31,0x31,0x34,0x20,0x22,0x61,0x73,0x73,0x65,
+    0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,
+    0x0a,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,
+    0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,
+    0x69,0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,
+    0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,
+    0x6f,0x61,0x74,0x3e,0x20,0x74,0x65,0x78,0x30,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x74,0x65,0x78,0x31,0x20,
+    0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x31,0x29,0x5d,0x5d,0x2c,0x20,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,
+    0x20,0x74,0x65,0x78,0x32,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,
+    0x32,0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,
+    0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x74,0x65,0x78,0x33,0x20,0x5b,0x5b,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x28,0x33,0x29,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,
+    0x74,0x61,0x6e,0x74,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,
+    0x5f,0x38,0x33,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,
+    0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x74,0x65,0x78,0x30,0x53,
+    0x6d,0x70,0x6c,0x72,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x30,
+    0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x74,0x65,0x78,
+    0x31,0x53,0x6d,0x70,0x6c,0x72,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,
+    0x28,0x31,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x74,
+    0x65,0x78,0x32,0x53,0x6d,0x70,0x6c,0x72,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x72,0x28,0x32,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,
+    0x20,0x74,0x65,0x78,0x33,0x53,0x6d,0x70,0x6c,0x72,0x20,0x5b,0x5b,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x28,0x33,0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,
+    0x20,0x7b,0x7d,0x3b,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x31,0x31,0x34,0x20,0x22,
+    0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,
+    0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x5f,0x31,0x32,0x20,0x3d,0x20,0x64,0x66,0x64,0x78,0x28,0x69,0x6e,0x2e,0x75,0x76,
+    0x29,0x3b,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x31,0x31,0x35,0x20,0x22,0x61,0x73,
+    0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,
+    0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x31,
+    0x35,0x20,0x3d,0x20,0x64,0x66,0x64,0x79,0x28,0x69,0x6e,0x2e,0x75,0x76,0x29,0x3b,
+    0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x31,0x31,0x37,0x20,0x22,0x61,0x73,0x73,0x65,
+    0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x2e,0x74,0x65,0x78,0x5f,0x69,0x6e,
+    0x64,0x65,0x78,0x20,0x3c,0x20,0x30,0x2e,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x31,0x31,0x38,0x20,0x22,0x61,0x73,0x73,0x65,
+    0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x74,0x65,0x78,
+    0x30,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x74,0x65,0x78,0x30,0x53,0x6d,0x70,
+    0x6c,0x72,0x2c,0x20,0x69,0x6e,0x2e,0x75,0x76,0x2c,0x20,0x67,0x72,0x61,0x64,0x69,
+    0x65,0x6e,0x74,0x32,0x64,0x28,0x5f,0x31,0x32,0x2c,0x20,0x5f,0x31,0x35,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x31,0x31,0x39,
+    0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x69,0x6e,0x2e,0x74,0x65,0x78,0x5f,0x69,0x6e,0x64,0x65,0x78,0x20,
+    0x3c,0x20,0x31,0x2e,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x31,0x32,0x30,0x20,0x22,0x61,0x73,0x73,0x65,
+    0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,
+    0x20,0x74,0x65,0x78,0x31,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x74,0x65,0x78,
+    0x31,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x69,0x6e,0x2e,0x75,0x76,0x2c,0x20,0x67,
+    0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x32,0x64,0x28,0x5f,0x31,0x32,0x2c,0x20,0x5f,
+    0x31,0x35,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x31,0x32,0x31,
+    0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x2e,0x74,0x65,0x78,0x5f,0x69,0x6e,
+    0x64,0x65,0x78,0x20,0x3c,0x20,0x32,0x2e,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x31,
+    0x32,0x32,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x74,0x65,0x78,
+    0x32,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x74,0x65,0x78,0x32,0x53,0x6d,0x70,
+    0x6c,0x72,0x2c,0x20,0x69,0x6e,0x2e,0x75,0x76,0x2c,0x20,0x67,0x72,0x61,0x64,0x69,
+    0x65,0x6e,0x74,0x32,0x64,0x28,0x5f,0x31,0x32,0x2c,0x20,0x5f,0x31,0x35,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x23,
+    0x6c,0x69,0x6e,0x65,0x20,0x31,0x32,0x34,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,
+    0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,
+    0x20,0x3d,0x20,0x74,0x65,0x78,0x33,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x74,
+    0x65,0x78,0x33,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x69,0x6e,0x2e,0x75,0x76,0x2c,
+    0x20,0x67,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x32,0x64,0x28,0x5f,0x31,0x32,0x2c,
+    0x20,0x5f,0x31,0x35,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x23,0x6c,0x69,0x6e,0x65,0x20,0x31,0x32,0x35,0x20,
+    0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,
+    0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x63,0x2e,
+    0x77,0x20,0x3c,0x20,0x5f,0x38,0x33,0x2e,0x61,0x6c,0x70,0x68,0x61,0x5f,0x63,0x75,
+    0x74,0x6f,0x66,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x23,0x6c,0x69,0x6e,
+    0x65,0x20,0x31,0x32,0x36,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x5f,0x66,0x72,0x61,0x67,
+    0x6d,0x65,0x6e,0x74,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x23,0x6c,
+    0x69,0x6e,0x65,0x20,0x31,0x32,0x37,0x20,0x22,0x61,0x73,0x73,0x65,0x74,0x73,0x2f,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x2e,0x67,0x6c,0x73,0x6c,0x22,0x0a,0x20,0x20,
+    0x20,0x20,0x6f,0x75,0x74,0x2e,0x66,0x72,0x61,0x67,0x43,0x6f,0x6c,0x6f,0x72,0x20,
+    0x3d,0x20,0x63,0x20,0x2a,0x20,0x69,0x6e,0x2e,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x00,
+};
+#if !defined(SOKOL_GFX_INCLUDED)
+  #error "Please include sokol_gfx.h before texture.glsl.h"
+#endif
+static inline const sg_shader_desc* texture_program_shader_desc(sg_backend backend) {
+  if (backend == SG_BACKEND_GLCORE33) {
+    static sg_shader_desc desc;
+    static bool valid;
+    if (!valid) {
+      valid = true;
+      desc.attrs[0].name = "position";
+      desc.attrs[1].name = "texcoord";
+      desc.attrs[2].name = "color";
+      desc.attrs[3].name = "depth";
+      desc.vs.source = texture_vs_source_glsl330;
+      desc.vs.entry = "main";
+      desc.vs.uniform_blocks[0].size = 32;
+      desc.vs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.vs.uniform_blocks[0].uniforms[0].name = "vs_params";
+      desc.vs.uniform_blocks[0].uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+      desc.vs.uniform_blocks[0].uniforms[0].array_count = 2;
+      desc.fs.source = texture_fs_source_glsl330;
+      desc.fs.entry = "main";
+      desc.fs.uniform_blocks[0].size = 16;
+      desc.fs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.uniform_blocks[0].uniforms[0].name = "fs_params";
+      desc.fs.uniform_blocks[0].uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+      desc.fs.uniform_blocks[0].uniforms[0].array_count = 1;
+      desc.fs.images[0].name = "tex";
+      desc.fs.images[0].image_type = SG_IMAGETYPE_2D;
+      desc.fs.images[0].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.label = "texture_program_shader";
+    }
+    return &desc;
+  }
+  if (backend == SG_BACKEND_D3D11) {
+    static sg_shader_desc desc;
+    static bool valid;
+    if (!valid) {
+      valid = true;
+      desc.attrs[0].sem_name = "TEXCOORD";
+      desc.attrs[0].sem_index = 0;
+      desc.attrs[1].sem_name = "TEXCOORD";
+      desc.attrs[1].sem_index = 1;
+      desc.attrs[2].sem_name = "TEXCOORD";
+      desc.attrs[2].sem_index = 2;
+      desc.attrs[3].sem_name = "TEXCOORD";
+      desc.attrs[3].sem_index = 3;
+      desc.vs.source = texture_vs_source_hlsl5;
+      desc.vs.d3d11_target = "vs_5_0";
+      desc.vs.entry = "main";
+      desc.vs.uniform_blocks[0].size = 32;
+      desc.vs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.source = texture_fs_source_hlsl5;
+      desc.fs.d3d11_target = "ps_5_0";
+      desc.fs.entry = "main";
+      desc.fs.uniform_blocks[0].size = 16;
+      desc.fs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.images[0].name = "tex";
+      desc.fs.images[0].image_type = SG_IMAGETYPE_2D;
+      desc.fs.images[0].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.label = "texture_program_shader";
+    }
+    return &desc;
+  }
+  if (backend == SG_BACKEND_METAL_MACOS) {
+    static sg_shader_desc desc;
     static bool valid;
     if (!valid) {
       valid = true;
-      desc.vs.bytecode.ptr = texture_vs_bytecode_metal_macos;
-      desc.vs.bytecode.size = 2746;
+      desc.vs.source = texture_vs_source_metal_macos;
       desc.vs.entry = "main0";
-      desc.fs.bytecode.ptr = texture_fs_bytecode_metal_macos;
-      desc.fs.bytecode.size = 2809;
+      desc.vs.uniform_blocks[0].size = 32;
+      desc.vs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.source = texture_fs_source_metal_macos;
       desc.fs.entry = "main0";
+      desc.fs.uniform_blocks[0].size = 16;
+      desc.fs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
       desc.fs.images[0].name = "tex";
       desc.fs.images[0].image_type = SG_IMAGETYPE_2D;
       desc.fs.images[0].sampler_type = SG_SAMPLERTYPE_FLOAT;
       desc.label = "texture_program_shader";
     }
-    return &desc;
-  }
-  return 0;
+    return &desc;
+  }
+  return 0;
+}
+static inline const sg_shader_desc* sprite_program_shader_desc(sg_backend backend) {
+  if (backend == SG_BACKEND_GLCORE33) {
+    static sg_shader_desc desc;
+    static bool valid;
+    if (!valid) {
+      valid = true;
+      desc.attrs[0].name = "corner";
+      desc.attrs[1].name = "rect";
+      desc.attrs[2].name = "clip";
+      desc.attrs[3].name = "color";
+      desc.attrs[4].name = "rotation";
+      desc.attrs[5].name = "depth";
+      desc.vs.source = sprite_vs_source_glsl330;
+      desc.vs.entry = "main";
+      desc.vs.uniform_blocks[0].size = 32;
+      desc.vs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.vs.uniform_blocks[0].uniforms[0].name = "vs_params";
+      desc.vs.uniform_blocks[0].uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+      desc.vs.uniform_blocks[0].uniforms[0].array_count = 2;
+      desc.fs.source = texture_fs_source_glsl330;
+      desc.fs.entry = "main";
+      desc.fs.uniform_blocks[0].size = 16;
+      desc.fs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.uniform_blocks[0].uniforms[0].name = "fs_params";
+      desc.fs.uniform_blocks[0].uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+      desc.fs.uniform_blocks[0].uniforms[0].array_count = 1;
+      desc.fs.images[0].name = "tex";
+      desc.fs.images[0].image_type = SG_IMAGETYPE_2D;
+      desc.fs.images[0].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.label = "sprite_program_shader";
+    }
+    return &desc;
+  }
+  if (backend == SG_BACKEND_D3D11) {
+    static sg_shader_desc desc;
+    static bool valid;
+    if (!valid) {
+      valid = true;
+      desc.attrs[0].sem_name = "TEXCOORD";
+      desc.attrs[0].sem_index = 0;
+      desc.attrs[1].sem_name = "TEXCOORD";
+      desc.attrs[1].sem_index = 1;
+      desc.attrs[2].sem_name = "TEXCOORD";
+      desc.attrs[2].sem_index = 2;
+      desc.attrs[3].sem_name = "TEXCOORD";
+      desc.attrs[3].sem_index = 3;
+      desc.attrs[4].sem_name = "TEXCOORD";
+      desc.attrs[4].sem_index = 4;
+      desc.attrs[5].sem_name = "TEXCOORD";
+      desc.attrs[5].sem_index = 5;
+      desc.vs.source = sprite_vs_source_hlsl5;
+      desc.vs.d3d11_target = "vs_5_0";
+      desc.vs.entry = "main";
+      desc.vs.uniform_blocks[0].size = 32;
+      desc.vs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.source = texture_fs_source_hlsl5;
+      desc.fs.d3d11_target = "ps_5_0";
+      desc.fs.entry = "main";
+      desc.fs.uniform_blocks[0].size = 16;
+      desc.fs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.images[0].name = "tex";
+      desc.fs.images[0].image_type = SG_IMAGETYPE_2D;
+      desc.fs.images[0].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.label = "sprite_program_shader";
+    }
+    return &desc;
+  }
+  if (backend == SG_BACKEND_METAL_MACOS) {
+    static sg_shader_desc desc;
+    static bool valid;
+    if (!valid) {
+      valid = true;
+      desc.vs.source = sprite_vs_source_metal_macos;
+      desc.vs.entry = "main0";
+      desc.vs.uniform_blocks[0].size = 32;
+      desc.vs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.source = texture_fs_source_metal_macos;
+      desc.fs.entry = "main0";
+      desc.fs.uniform_blocks[0].size = 16;
+      desc.fs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.images[0].name = "tex";
+      desc.fs.images[0].image_type = SG_IMAGETYPE_2D;
+      desc.fs.images[0].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.label = "sprite_program_shader";
+    }
+    return &desc;
+  }
+  return 0;
+}
+static inline const sg_shader_desc* multi_program_shader_desc(sg_backend backend) {
+  if (backend == SG_BACKEND_GLCORE33) {
+    static sg_shader_desc desc;
+    static bool valid;
+    if (!valid) {
+      valid = true;
+      desc.attrs[0].name = "position";
+      desc.attrs[1].name = "texcoord";
+      desc.attrs[2].name = "color";
+      desc.attrs[3].name = "slot";
+      desc.attrs[4].name = "depth";
+      desc.vs.source = multi_vs_source_glsl330;
+      desc.vs.entry = "main";
+      desc.vs.uniform_blocks[0].size = 32;
+      desc.vs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.vs.uniform_blocks[0].uniforms[0].name = "vs_params";
+      desc.vs.uniform_blocks[0].uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+      desc.vs.uniform_blocks[0].uniforms[0].array_count = 2;
+      desc.fs.source = multi_fs_source_glsl330;
+      desc.fs.entry = "main";
+      desc.fs.uniform_blocks[0].size = 16;
+      desc.fs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.uniform_blocks[0].uniforms[0].name = "fs_params";
+      desc.fs.uniform_blocks[0].uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+      desc.fs.uniform_blocks[0].uniforms[0].array_count = 1;
+      desc.fs.images[0].name = "tex0";
+      desc.fs.images[0].image_type = SG_IMAGETYPE_2D;
+      desc.fs.images[0].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.fs.images[1].name = "tex1";
+      desc.fs.images[1].image_type = SG_IMAGETYPE_2D;
+      desc.fs.images[1].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.fs.images[2].name = "tex2";
+      desc.fs.images[2].image_type = SG_IMAGETYPE_2D;
+      desc.fs.images[2].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.fs.images[3].name = "tex3";
+      desc.fs.images[3].image_type = SG_IMAGETYPE_2D;
+      desc.fs.images[3].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.label = "multi_program_shader";
+    }
+    return &desc;
+  }
+  if (backend == SG_BACKEND_D3D11) {
+    static sg_shader_desc desc;
+    static bool valid;
+    if (!valid) {
+      valid = true;
+      desc.attrs[0].sem_name = "TEXCOORD";
+      desc.attrs[0].sem_index = 0;
+      desc.attrs[1].sem_name = "TEXCOORD";
+      desc.attrs[1].sem_index = 1;
+      desc.attrs[2].sem_name = "TEXCOORD";
+      desc.attrs[2].sem_index = 2;
+      desc.attrs[3].sem_name = "TEXCOORD";
+      desc.attrs[3].sem_index = 3;
+      desc.attrs[4].sem_name = "TEXCOORD";
+      desc.attrs[4].sem_index = 4;
+      desc.vs.source = multi_vs_source_hlsl5;
+      desc.vs.d3d11_target = "vs_5_0";
+      desc.vs.entry = "main";
+      desc.vs.uniform_blocks[0].size = 32;
+      desc.vs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.source = multi_fs_source_hlsl5;
+      desc.fs.d3d11_target = "ps_5_0";
+      desc.fs.entry = "main";
+      desc.fs.uniform_blocks[0].size = 16;
+      desc.fs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.images[0].name = "tex0";
+      desc.fs.images[0].image_type = SG_IMAGETYPE_2D;
+      desc.fs.images[0].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.fs.images[1].name = "tex1";
+      desc.fs.images[1].image_type = SG_IMAGETYPE_2D;
+      desc.fs.images[1].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.fs.images[2].name = "tex2";
+      desc.fs.images[2].image_type = SG_IMAGETYPE_2D;
+      desc.fs.images[2].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.fs.images[3].name = "tex3";
+      desc.fs.images[3].image_type = SG_IMAGETYPE_2D;
+      desc.fs.images[3].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.label = "multi_program_shader";
+    }
+    return &desc;
+  }
+  if (backend == SG_BACKEND_METAL_MACOS) {
+    static sg_shader_desc desc;
+    static bool valid;
+    if (!valid) {
+      valid = true;
+      desc.vs.source = multi_vs_source_metal_macos;
+      desc.vs.entry = "main0";
+      desc.vs.uniform_blocks[0].size = 32;
+      desc.vs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.source = multi_fs_source_metal_macos;
+      desc.fs.entry = "main0";
+      desc.fs.uniform_blocks[0].size = 16;
+      desc.fs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.images[0].name = "tex0";
+      desc.fs.images[0].image_type = SG_IMAGETYPE_2D;
+      desc.fs.images[0].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.fs.images[1].name = "tex1";
+      desc.fs.images[1].image_type = SG_IMAGETYPE_2D;
+      desc.fs.images[1].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.fs.images[2].name = "tex2";
+      desc.fs.images[2].image_type = SG_IMAGETYPE_2D;
+      desc.fs.images[2].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.fs.images[3].name = "tex3";
+      desc.fs.images[3].image_type = SG_IMAGETYPE_2D;
+      desc.fs.images[3].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.label = "multi_program_shader";
+    }
+    return &desc;
+  }
+  return 0;
+}
+#endif
+
+typedef MisoVertex Quad[4];
+
+static const vs_params_t IdentityTransform = {
+    .transform_x = {1.f, 0.f, 0.f, 0.f},
+    .transform_y = {0.f, 1.f, 0.f, 0.f}
+};
+
+static MisoVec2 TransformPoint(const MisoTransform *transform, MisoVec2 point) {
+    return (MisoVec2) {
+        transform->x[0] * point.x + transform->x[1] * point.y + transform->x[2],
+        transform->y[0] * point.x + transform->y[1] * point.y + transform->y[2]
+    };
+}
+
+static MisoTransform ViewportTransform(MisoVec2 scale, MisoVec2 viewportSize) {
+    // Pixels -> NDC, scaled around the centre of the viewport
+    float sx =  2.f / viewportSize.x * scale.x;
+    float sy = -2.f / viewportSize.y * scale.y;
+    return (MisoTransform) {
+        .x = {sx, 0.f, -scale.x},
+        .y = {0.f, sy, scale.y}
+    };
+}
+
+static const MisoTransform* QuadViewport(MisoVec2 scale, MisoVec2 viewportSize) {
+    // Screen space draws nearly always share a scale and viewport, so like
+    // MisoUpdateCamera the transform is only rebuilt when either changes
+    if (state.quadScale.x != scale.x || state.quadScale.y != scale.y ||
+        state.quadViewportSize.x != viewportSize.x || state.quadViewportSize.y != viewportSize.y) {
+        state.quadViewport = ViewportTransform(scale, viewportSize);
+        state.quadScale = scale;
+        state.quadViewportSize = viewportSize;
+    }
+    return &state.quadViewport;
+}
+
+static vs_params_t CameraTransform(MisoCamera *camera) {
+    MisoUpdateCamera(camera);
+    const MisoTransform *clip = &camera->worldToClip;
+    return (vs_params_t) {
+        .transform_x = {clip->x[0], clip->x[1], clip->x[2], 0.f},
+        .transform_y = {clip->y[0], clip->y[1], clip->y[2], 0.f}
+    };
+}
+
+static vs_params_t PixelTransform(void) {
+    // Framebuffer pixels -> NDC, used by instanced sprites
+    float sx =  2.f / state.size.x;
+    float sy = -2.f / state.size.y;
+    return (vs_params_t) {
+        .transform_x = {sx, 0.f, -1.f, 0.f},
+        .transform_y = {0.f, sy, 1.f, 0.f}
+    };
+}
+
+static void ApplyTransform(const vs_params_t *params) {
+    sg_range range = {
+        .ptr = params,
+        .size = sizeof(vs_params_t)
+    };
+    sg_apply_uniforms(SG_SHADERSTAGE_VS, SLOT_vs_params, &range);
+}
+
+static void ApplyAlphaCutoff(float cutoff) {
+    fs_params_t params = {
+        .alpha_cutoff = cutoff
+    };
+    sg_range range = {
+        .ptr = &params,
+        .size = sizeof(fs_params_t)
+    };
+    sg_apply_uniforms(SG_SHADERSTAGE_FS, SLOT_fs_params, &range);
+}
+
+static sg_pipeline TexturePipeline(MisoVertexFormat format, sg_index_type type, float cutoff) {
+    // Cut out batches write depth, anything else is blended over what's
+    // already there and has to be drawn back to front
+    return state.offscreen_pip[format][type == SG_INDEXTYPE_UINT32][cutoff > 0.f];
+}
+
+static void GenerateQuadVertices(MisoVec2 quad[4], MisoVec2 textureSize, MisoRect clip, float depth, Quad *out) {
+    float iw = 1.f/textureSize.x, ih = 1.f/(float)textureSize.y;
+    float tl = clip.x*iw;
+    float tt = clip.y*ih;
+    float tr = (clip.x + clip.w)*iw;
+    float tb = (clip.y + clip.h)*ih;
+    MisoVec2 vtexquad[4] = {
+        {tl, tb}, // bottom left
+        {tr, tb}, // bottom right
+        {tr, tt}, // top right
+        {tl, tt}, // top left
+    };
+    for (int i = 0; i < 4; i++)
+        (*out)[i] = (MisoVertex) {
+            .position = quad[i],
+            .texcoord = vtexquad[i],
+            .color = {1.f, 1.f, 1.f, 1.f},
+            .depth = depth
+        };
+}
+
+static sg_buffer MakeQuadIndices(int quads, sg_index_type *type) {
+    // Every quad is 4 vertices, shared between two triangles by the index buffer
+    *type = quads * 4 > 65536 ? SG_INDEXTYPE_UINT32 : SG_INDEXTYPE_UINT16;
+    size_t indexSize = *type == SG_INDEXTYPE_UINT32 ? sizeof(uint32_t) : sizeof(uint16_t);
+    void *indices = malloc(quads * 6 * indexSize);
+    static const int offsets[6] = {
+        0, 1, 2,
+        3, 0, 2
+    };
+    for (int i = 0; i < quads; i++)
+        for (int j = 0; j < 6; j++) {
+            uint32_t index = i * 4 + offsets[j];
+            if (*type == SG_INDEXTYPE_UINT32)
+                ((uint32_t*)indices)[i * 6 + j] = index;
+            else
+                ((uint16_t*)indices)[i * 6 + j] = (uint16_t)index;
+        }
+    sg_buffer_desc desc = {
+        .type = SG_BUFFERTYPE_INDEXBUFFER,
+        .data = (sg_range) {
+            .ptr = indices,
+            .size = quads * 6 * indexSize
+        }
+    };
+    sg_buffer result = sg_make_buffer(&desc);
+    free(indices);
+    return result;
+}
+
+// Quads staged by MisoDrawTexture before they are drawn, at most 16384 so
+// the shared index buffer stays 16 bit
+#if !defined(MISO_TRANSIENT_QUADS)
+#define MISO_TRANSIENT_QUADS 4096
+#endif
+
+static sg_buffer TransientBuffer(size_t size) {
+    // Transient vertices are appended to a stream buffer, sokol rewinds it on
+    // the first append of each frame. Once it fills up the rest of the frame
+    // moves on to the next buffer, which is kept around for the following frames
+    assert(size <= MISO_TRANSIENT_QUADS * sizeof(Quad));
+    while (state.transientIndex < state.transientCount &&
+           sg_query_buffer_will_overflow(state.transient[state.transientIndex], size))
+        state.transientIndex++;
+    if (state.transientIndex == state.transientCount) {
+        state.transient = realloc(state.transient, ++state.transientCount * sizeof(sg_buffer));
+        sg_buffer_desc desc = {
+            .usage = SG_USAGE_STREAM,
+            .size = MISO_TRANSIENT_QUADS * sizeof(Quad)
+        };
+        state.transient[state.transientIndex] = sg_make_buffer(&desc);
+    }
+    return state.transient[state.transientIndex];
+}
+
+static void FlushImmediate(void) {
+    // MisoDrawTexture only stages its quads, they are appended and drawn here
+    // right before anything else touches the pass. Appending once per quad
+    // makes most drivers wait on the draw that is still reading the buffer
+    if (!state.immediateCount)
+        return;
+    sg_range range = {
+        .ptr = state.immediate,
+        .size = state.immediateCount * sizeof(Quad)
+    };
+    sg_buffer buffer = TransientBuffer(range.size);
+    int offset = sg_append_buffer(buffer, &range);
+    // Impostors are baked into a target without a depth buffer
+    sg_apply_pipeline(state.baking ? state.lodPipeline : TexturePipeline(MISO_VERTEX_DEFAULT, SG_INDEXTYPE_UINT16, state.immediateCutoff));
+    ApplyTransform(&IdentityTransform);
+    ApplyAlphaCutoff(state.immediateCutoff);
+    for (int i = 0; i < state.immediateRunCount; i++) {
+        sg_bindings bind = {
+            .vertex_buffers[0] = buffer,
+            .vertex_buffer_offsets[0] = offset,
+            .index_buffer = state.transientIndices,
+            .fs_images[SLOT_tex] = state.immediateRuns[i].texture->sg
+        };
+        sg_apply_bindings(&bind);
+        sg_draw(state.immediateRuns[i].first * 6, state.immediateRuns[i].count * 6, 1);
+    }
+    state.immediateCount = 0;
+    state.immediateRunCount = 0;
+}
+
+static void ApplyTexturePipeline(MisoVertexFormat format, sg_index_type type, float cutoff) {
+    FlushImmediate();
+    sg_apply_pipeline(TexturePipeline(format, type, cutoff));
+    ApplyAlphaCutoff(cutoff);
+}
+
+static size_t QuadSize(MisoVertexFormat format) {
+    switch (format) {
+        case MISO_VERTEX_COMPACT:
+            return 4 * sizeof(MisoCompactVertex);
+        case MISO_VERTEX_INSTANCED:
+            return sizeof(MisoSpriteInstance);
+        case MISO_VERTEX_MULTI:
+            return 4 * sizeof(MisoMultiVertex);
+        default:
+            return 4 * sizeof(MisoVertex);
+    }
+}
+
+static unsigned short PackUnorm16(float v) {
+    return (unsigned short)(MAX(0.f, MIN(1.f, v)) * 65535.f + .5f);
+}
+
+static unsigned char PackUnorm8(float v) {
+    return (unsigned char)(MAX(0.f, MIN(1.f, v)) * 255.f + .5f);
+}
+
+static MisoColor PackColor(MisoVec4 color) {
+    return (MisoColor) {
+        .r = PackUnorm8(color.x),
+        .g = PackUnorm8(color.y),
+        .b = PackUnorm8(color.z),
+        .a = PackUnorm8(color.w)
+    };
+}
+
+static void StoreMultiQuad(void *vertices, int index, const Quad *quad, int slot) {
+    MisoMultiVertex *out = (MisoMultiVertex*)vertices + index * 4;
+    for (int i = 0; i < 4; i++)
+        out[i] = (MisoMultiVertex) {
+            .position = (*quad)[i].position,
+            .texcoord = (*quad)[i].texcoord,
+            .color = PackColor((*quad)[i].color),
+            .slot = (float)slot,
+            .depth = (*quad)[i].depth
+        };
+}
+
+static void StoreQuad(MisoVertexFormat format, void *vertices, int index, const Quad *quad) {
+    // Compact texcoords are normalized, so clips outside of the texture are clamped to its edge
+    assert(format != MISO_VERTEX_INSTANCED);
+    if (format == MISO_VERTEX_MULTI)
+        StoreMultiQuad(vertices, index, quad, 0);
+    else if (format == MISO_VERTEX_COMPACT) {
+        MisoCompactVertex *out = (MisoCompactVertex*)vertices + index * 4;
+        for (int i = 0; i < 4; i++) {
+            const MisoVertex *v = &(*quad)[i];
+            out[i] = (MisoCompactVertex) {
+                .position = v->position,
+                .texcoord = {PackUnorm16(v->texcoord.x), PackUnorm16(v->texcoord.y)},
+                .color = PackColor(v->color),
+                .depth = v->depth
+            };
+        }
+    } else
+        memcpy((MisoVertex*)vertices + index * 4, quad, sizeof(Quad));
+}
+
+static void GenerateQuad(const MisoTransform *viewport, MisoVec2 position, MisoVec2 textureSize, MisoVec2 size, float rotation, MisoRect clip, float depth, Quad *out) {
+    MisoVec2 quad[4] = {
+        {position.x, position.y + size.y}, // bottom left
+        {position.x + size.x, position.y + size.y}, // bottom right
+        {position.x + size.x, position.y }, // top right
+        {position.x, position.y }, // top left
+    };
+    if (rotation != 0.f) {
+        // Turned around its centre in framebuffer pixels, the same as an
+        // instanced sprite, so a non-square viewport doesn't skew it
+        float c = cosf(rotation), s = sinf(rotation);
+        float px = viewport->x[0] * state.size.x / 2.f, py = -viewport->y[1] * state.size.y / 2.f;
+        MisoVec2 centre = {position.x + size.x / 2.f, position.y + size.y / 2.f};
+        for (int j = 0; j < 4; j++) {
+            float dx = (quad[j].x - centre.x) * px, dy = (quad[j].y - centre.y) * py;
+            quad[j] = (MisoVec2){centre.x + (dx * c - dy * s) / px, centre.y + (dx * s + dy * c) / py};
+        }
+    }
+    for (int j = 0; j < 4; j++)
+        quad[j] = TransformPoint(viewport, quad[j]);
+    GenerateQuadVertices(quad, textureSize, clip, depth, out);
+}
+
+static void GenerateWorldQuad(MisoVec2 position, MisoVec2 textureSize, MisoVec2 size, MisoRect clip, float depth, Quad *out) {
+    MisoVec2 quad[4] = {
+        {position.x, position.y + size.y}, // bottom left
+        {position.x + size.x, position.y + size.y}, // bottom right
+        {position.x + size.x, position.y }, // top right
+        {position.x, position.y }, // top left
+    };
+    GenerateQuadVertices(quad, textureSize, clip, depth, out);
+}
+
+static void GenerateQuads(const MisoSprite *sprites, int count, MisoVec2 textureSize, MisoVec2 scale, MisoVec2 viewportSize, Quad *out) {
+    // Same math as GenerateQuad, with everything that doesn't depend on the
+    // sprite hoisted out. Corners are worked on as (x0, y0, x1, y1) so one
+    // vector op covers a whole quad, rotated sprites are left to GenerateQuad
+    const MisoTransform *viewport = QuadViewport(scale, viewportSize);
+    float vw = viewport->x[0], vh = viewport->y[1];
+    float ox = viewport->x[2], oy = viewport->y[2];
+    float iw = 1.f / textureSize.x, ih = 1.f / textureSize.y;
+#if defined(MISO_SSE2)
+    const __m128 ndcScale = _mm_setr_ps(vw, vh, vw, vh);
+    const __m128 ndcOffset = _mm_setr_ps(ox, oy, ox, oy);
+    const __m128 texScale = _mm_setr_ps(iw, ih, iw, ih);
+    const __m128 white = _mm_set1_ps(1.f);
+    for (int i = 0; i < count; i++) {
+        const MisoSprite *sprite = &sprites[i];
+        if (sprite->rotation != 0.f) {
+            GenerateQuad(viewport, sprite->position, textureSize, sprite->size, sprite->rotation, sprite->clip, sprite->depth, &out[i]);
+            continue;
+        }
+        __m128 rect = _mm_setr_ps(sprite->position.x, sprite->position.y, sprite->size.x, sprite->size.y);
+        __m128 clip = _mm_setr_ps(sprite->clip.x, sprite->clip.y, sprite->clip.w, sprite->clip.h);
+        // (x, y, w, h) -> (x, y, x + w, y + h)
+        rect = _mm_add_ps(rect, _mm_movelh_ps(_mm_setzero_ps(), rect));
+        clip = _mm_add_ps(clip, _mm_movelh_ps(_mm_setzero_ps(), clip));
+        __m128 pos = _mm_add_ps(_mm_mul_ps(rect, ndcScale), ndcOffset);
+        __m128 tex = _mm_mul_ps(clip, texScale);
+        __m128 tl = _mm_movelh_ps(pos, tex); // x0 y0 u0 v0
+        __m128 br = _mm_movehl_ps(tex, pos); // x1 y1 u1 v1
+        __m128 xy = _mm_unpacklo_ps(tl, br); // x0 x1 y0 y1
+        __m128 uv = _mm_unpackhi_ps(tl, br); // u0 u1 v0 v1
+        MisoVertex *v = out[i];
+        _mm_storeu_ps(&v[0].position.x, _mm_shuffle_ps(xy, uv, _MM_SHUFFLE(3, 0, 3, 0))); // bottom left
+        _mm_storeu_ps(&v[1].position.x, br); // bottom right
+        _mm_storeu_ps(&v[2].position.x, _mm_shuffle_ps(xy, uv, _MM_SHUFFLE(2, 1, 2, 1))); // top right
+        _mm_storeu_ps(&v[3].position.x, tl); // top left
+        for (int j = 0; j < 4; j++) {
+            _mm_storeu_ps(&v[j].color.x, white);
+            v[j].depth = sprite->depth;
+        }
+    }
+#elif defined(MISO_NEON)
+    const float32x4_t ndcScale = {vw, vh, vw, vh};
+    const float32x4_t ndcOffset = {ox, oy, ox, oy};
+    const float32x4_t texScale = {iw, ih, iw, ih};
+    const float32x4_t white = vdupq_n_f32(1.f);
+    const uint32x2_t second = {0, 0xFFFFFFFF};
+    for (int i = 0; i < count; i++) {
+        const MisoSprite *sprite = &sprites[i];
+        if (sprite->rotation != 0.f) {
+            GenerateQuad(viewport, sprite->position, textureSize, sprite->size, sprite->rotation, sprite->clip, sprite->depth, &out[i]);
+            continue;
+        }
+        float32x4_t rect = {sprite->position.x, sprite->position.y, sprite->size.x, sprite->size.y};
+        float32x4_t clip = {sprite->clip.x, sprite->clip.y, sprite->clip.w, sprite->clip.h};
+        // (x, y, w, h) -> (x, y, x + w, y + h)
+        rect = vaddq_f32(rect, vcombine_f32(vdup_n_f32(0.f), vget_low_f32(rect)));
+        clip = vaddq_f32(clip, vcombine_f32(vdup_n_f32(0.f), vget_low_f32(clip)));
+        float32x4_t pos = vaddq_f32(vmulq_f32(rect, ndcScale), ndcOffset);
+        float32x4_t tex = vmulq_f32(clip, texScale);
+        float32x2_t p0 = vget_low_f32(pos), p1 = vget_high_f32(pos);
+        float32x2_t t0 = vget_low_f32(tex), t1 = vget_high_f32(tex);
+        MisoVertex *v = out[i];
+        vst1q_f32(&v[0].position.x, vcombine_f32(vbsl_f32(second, p1, p0), vbsl_f32(second, t1, t0))); // bottom left
+        vst1q_f32(&v[1].position.x, vcombine_f32(p1, t1)); // bottom right
+        vst1q_f32(&v[2].position.x, vcombine_f32(vbsl_f32(second, p0, p1), vbsl_f32(second, t0, t1))); // top right
+        vst1q_f32(&v[3].position.x, vcombine_f32(p0, t0)); // top left
+        for (int j = 0; j < 4; j++) {
+            vst1q_f32(&v[j].color.x, white);
+            v[j].depth = sprite->depth;
+        }
+    }
+#else
+    for (int i = 0; i < count; i++) {
+        const MisoSprite *sprite = &sprites[i];
+        if (sprite->rotation != 0.f) {
+            GenerateQuad(viewport, sprite->position, textureSize, sprite->size, sprite->rotation, sprite->clip, sprite->depth, &out[i]);
+            continue;
+        }
+        float x0 = vw * sprite->position.x + ox;
+        float y0 = vh * sprite->position.y + oy;
+        float x1 = vw * (sprite->position.x + sprite->size.x) + ox;
+        float y1 = vh * (sprite->position.y + sprite->size.y) + oy;
+        float u0 = sprite->clip.x * iw;
+        float v0 = sprite->clip.y * ih;
+        float u1 = (sprite->clip.x + sprite->clip.w) * iw;
+        float v1 = (sprite->clip.y + sprite->clip.h) * ih;
+        out[i][0] = (MisoVertex){{x0, y1}, {u0, v1}, {1.f, 1.f, 1.f, 1.f}, sprite->depth}; // bottom left
+        out[i][1] = (MisoVertex){{x1, y1}, {u1, v1}, {1.f, 1.f, 1.f, 1.f}, sprite->depth}; // bottom right
+        out[i][2] = (MisoVertex){{x1, y0}, {u1, v0}, {1.f, 1.f, 1.f, 1.f}, sprite->depth}; // top right
+        out[i][3] = (MisoVertex){{x0, y0}, {u0, v0}, {1.f, 1.f, 1.f, 1.f}, sprite->depth}; // top left
+    }
+#endif
+}
+
+float MisoIsoDepth(float row, float height) {
+    // Rows further down the screen are closer, height orders sprites within a row.
+    // Depth 0 is left free for anything that should stay on top, like MisoTextureBatchDraw
+    row = MAX(0.f, MIN(MISO_DEPTH_ROWS - 1.f, row + MISO_DEPTH_ROWS / 2));
+    height = MAX(0.f, MIN(MISO_DEPTH_LAYERS - 1.f, height));
+    return 1.f - (row * MISO_DEPTH_LAYERS + height + 1.f) / ((float)MISO_DEPTH_ROWS * MISO_DEPTH_LAYERS + 1.f);
+}
+
+static Quad* StageImmediate(MisoTexture *texture, float cutoff) {
+    // Every quad of a flush shares one pipeline
+    if (state.immediateCount == MISO_TRANSIENT_QUADS || (state.immediateCount && state.immediateCutoff != cutoff))
+        FlushImmediate();
+    state.immediateCutoff = cutoff;
+    // Consecutive draws with the same texture share a draw call
+    MisoRenderRun *run = state.immediateRunCount ? &state.immediateRuns[state.immediateRunCount - 1] : NULL;
+    if (run && run->texture == texture)
+        run->count++;
+    else
+        state.immediateRuns[state.immediateRunCount++] = (MisoRenderRun) {
+            .texture = texture,
+            .first = state.immediateCount,
+            .count = 1
+        };
+    return (Quad*)state.immediate + state.immediateCount++;
+}
+
+void MisoDrawTexture(MisoTexture *texture, MisoVec2 position, MisoVec2 size, MisoVec2 scale, MisoVec2 viewportSize, float rotation, MisoRect clip) {
+    assert(state.inProgress);
+    GenerateQuad(QuadViewport(scale, viewportSize), position, (MisoVec2){texture->w, texture->h}, size, rotation, clip, 0.f, StageImmediate(texture, 0.f));
+}
+
+void MisoFlush(void) {
+    // Anything else drawing into the pass, like a UI, has to come after the
+    // staged quads or they'd land on top of it
+    assert(state.inProgress);
+    FlushImmediate();
+}
+
+void MisoDestroyTexture(MisoTexture *texture) {
+    if (texture) {
+        FlushImmediate();
+        if (sg_query_image_state(texture->sg) == SG_RESOURCESTATE_VALID)
+            sg_destroy_image(texture->sg);
+        free(texture);
+    }
+}
+
+MisoAtlas* MisoCreateAtlas(int w, int h, int padding) {
+    assert(w > 0 && h > 0 && padding >= 0);
+    MisoAtlas *result = malloc(sizeof(MisoAtlas));
+    result->image = MisoEmptyImage(w, h);
+    memset(result->image->buf, 0, w * h * sizeof(int));
+    result->texture = NULL;
+    // The skyline never has more segments than the atlas is wide, plus one
+    // while a new segment is being inserted
+    result->skyline = malloc((w + 1) * sizeof(MisoAtlasNode));
+    result->skyline[0] = (MisoAtlasNode){0, 0, w};
+    result->nodeCount = 1;
+    result->padding = padding;
+    result->dirty = true;
+    return result;
+}
+
+static int AtlasFit(MisoAtlas *atlas, int index, int w, int h) {
+    // Lowest y a w*h rect can sit at with its left edge on this node, or -1
+    MisoAtlasNode *node = &atlas->skyline[index];
+    if (node->x + w > atlas->image->w)
+        return -1;
+    int y = node->y;
+    for (int remaining = w; remaining > 0; remaining -= node->w, node++) {
+        y = MAX(y, node->y);
+        if (y + h > atlas->image->h)
+            return -1;
+    }
+    return y;
+}
+
+static void AtlasInsert(MisoAtlas *atlas, int index, int x, int y, int w) {
+    memmove(&atlas->skyline[index + 1], &atlas->skyline[index], (atlas->nodeCount - index) * sizeof(MisoAtlasNode));
+    atlas->skyline[index] = (MisoAtlasNode){x, y, w};
+    atlas->nodeCount++;
+    // Trim or drop the nodes now covered by the new one
+    for (int i = index + 1; i < atlas->nodeCount;) {
+        MisoAtlasNode *prev = &atlas->skyline[i - 1];
+        MisoAtlasNode *node = &atlas->skyline[i];
+        int shrink = prev->x + prev->w - node->x;
+        if (shrink <= 0)
+            break;
+        if (shrink < node->w) {
+            node->x += shrink;
+            node->w -= shrink;
+            break;
+        }
+        memmove(node, node + 1, (atlas->nodeCount - i - 1) * sizeof(MisoAtlasNode));
+        atlas->nodeCount--;
+    }
+    // Neighbours at the same height become one segment
+    for (int i = 0; i < atlas->nodeCount - 1;) {
+        MisoAtlasNode *node = &atlas->skyline[i];
+        if (node->y == node[1].y) {
+            node->w += node[1].w;
+            memmove(node + 1, node + 2, (atlas->nodeCount - i - 2) * sizeof(MisoAtlasNode));
+            atlas->nodeCount--;
+        } else
+            i++;
+    }
+}
+
+bool MisoAtlasPack(MisoAtlas *atlas, MisoImage *img, MisoRect *rect) {
+    // Bottom-left skyline packing, each image goes wherever its top edge ends
+    // up lowest, ties going to the narrowest segment to keep gaps small
+    int w = img->w + atlas->padding;
+    int h = img->h + atlas->padding;
+    int best = -1, bestY = INT_MAX, bestW = INT_MAX;
+    for (int i = 0; i < atlas->nodeCount; i++) {
+        int y = AtlasFit(atlas, i, w, h);
+        if (y < 0)
+            continue;
+        if (y + h < bestY || (y + h == bestY && atlas->skyline[i].w < bestW)) {
+            best = i;
+            bestY = y + h;
+            bestW = atlas->skyline[i].w;
+        }
+    }
+    if (best < 0)
+        return false;
+    int x = atlas->skyline[best].x;
+    int y = bestY - h;
+    AtlasInsert(atlas, best, x, bestY, w);
+    for (int row = 0; row < img->h; row++)
+        memcpy(&atlas->image->buf[(y + row) * atlas->image->w + x], &img->buf[row * img->w], img->w * sizeof(int));
+    atlas->dirty = true;
+    if (rect)
+        *rect = (MisoRect){x, y, img->w, img->h};
+    return true;
+}
+
+MisoTexture* MisoAtlasTexture(MisoAtlas *atlas) {
+    // Uploads are deferred until the texture is needed, so packing a whole
+    // set of images costs a single upload
+    if (!atlas->texture)
+        atlas->texture = MisoEmptyTexture(atlas->image->w, atlas->image->h);
+    if (atlas->dirty) {
+        MisoUpdateTexture(atlas->texture, atlas->image);
+        atlas->dirty = false;
+    }
+    return atlas->texture;
+}
+
+void MisoDestroyAtlas(MisoAtlas *atlas) {
+    if (atlas) {
+        MisoDestroyImage(atlas->image);
+        MisoDestroyTexture(atlas->texture);
+        if (atlas->skyline)
+            free(atlas->skyline);
+        free(atlas);
+    }
+}
+
+static void FreeSpillBuffers(MisoTextureBatch *batch) {
+    for (int i = 0; i < batch->spillCount; i++)
+        if (sg_query_buffer_state(batch->spillBuffers[i]) == SG_RESOURCESTATE_VALID)
+            sg_destroy_buffer(batch->spillBuffers[i]);
+    if (batch->spillBuffers)
+        free(batch->spillBuffers);
+    batch->spillBuffers = NULL;
+    batch->spillCount = 0;
+}
+
+static void ResizeTextureBatch(MisoTextureBatch *batch, int max) {
+    // Queued vertices are kept, anything past the new size is dropped
+    batch->maxVertices = max * 4;
+    batch->vertexCount = MIN(batch->vertexCount, batch->maxVertices);
+    batch->vertices = realloc(batch->vertices, max * QuadSize(batch->format));
+    if (sg_query_buffer_state(batch->bind.vertex_buffers[0]) == SG_RESOURCESTATE_VALID)
+        sg_destroy_buffer(batch->bind.vertex_buffers[0]);
+    FreeSpillBuffers(batch);
+    sg_buffer_desc desc = {
+        .usage = SG_USAGE_STREAM,
+        .size = max * QuadSize(batch->format)
+    };
+    batch->bind.vertex_buffers[0] = sg_make_buffer(&desc);
+    // None of the new buffers have been written yet this frame
+    batch->flushCount = 0;
+    // Instanced batches expand the shared unit quad, so they have no indices of their own
+    if (batch->format == MISO_VERTEX_INSTANCED)
+        return;
+    if (sg_query_buffer_state(batch->bind.index_buffer) == SG_RESOURCESTATE_VALID)
+        sg_destroy_buffer(batch->bind.index_buffer);
+    batch->bind.index_buffer = MakeQuadIndices(max, &batch->indexType);
+}
+
+MisoTextureBatch* MisoMakeTextureBatch(MisoTextureBatchDesc *desc) {
+    assert(desc && desc->format < MISO_VERTEX_FORMAT_COUNT && desc->maxQuads > 0);
+    MisoTexture *texture = desc->texture ? desc->texture : desc->textures[0];
+    assert(texture);
+    MisoTextureBatch *result = malloc(sizeof(MisoTextureBatch));
+    memset(result, 0, sizeof(MisoTextureBatch));
+    result->format = desc->format;
+    result->flushWhenFull = desc->flushWhenFull;
+    result->alphaCutoff = desc->alphaCutoff;
+    result->size = (MisoVec2){texture->w, texture->h};
+    result->texture = texture;
+    result->indexType = SG_INDEXTYPE_UINT16;
+    result->textures[result->textureCount++] = texture;
+    if (desc->format == MISO_VERTEX_MULTI) {
+        // Slots are the primary texture followed by the extra textures
+        for (int i = desc->texture ? 0 : 1; i < MISO_MAX_BATCH_TEXTURES && desc->textures[i]; i++) {
+            assert(result->textureCount < MISO_MAX_BATCH_TEXTURES);
+            result->textures[result->textureCount++] = desc->textures[i];
+        }
+        // Every sampler in multi_fs has to be bound, spare slots repeat the first texture
+        for (int i = 0; i < MISO_MAX_BATCH_TEXTURES; i++)
+            result->bind.fs_images[SLOT_tex0 + i] = result->textures[i < result->textureCount ? i : 0]->sg;
+    } else
+        result->bind.fs_images[SLOT_tex] = texture->sg;
+    ResizeTextureBatch(result, desc->maxQuads);
+    return result;
+}
+
+MisoTextureBatch* MisoCreateTextureBatch(MisoTexture *texture, int max) {
+    MisoTextureBatchDesc desc = {
+        .texture = texture,
+        .maxQuads = max
+    };
+    return MisoMakeTextureBatch(&desc);
+}
+
+void MisoResizeTextureBatch(MisoTextureBatch **batch, int newMaxQuads) {
+    // Resized in place, *batch is never reassigned and stays valid. The
+    // double pointer is only kept so existing callers still compile
+    assert(batch && *batch && newMaxQuads > 0);
+    ResizeTextureBatch(*batch, newMaxQuads);
+}
+
+static void ReserveTextureBatch(MisoTextureBatch *batch, int max) {
+    if (max * 4 > batch->maxVertices)
+        ResizeTextureBatch(batch, max);
+}
+
+static void MakeRoomInTextureBatch(MisoTextureBatch *batch) {
+    if (batch->vertexCount + 4 <= batch->maxVertices)
+        return;
+    if (batch->flushWhenFull)
+        MisoFlushTextureBatch(batch);
+    else
+        ReserveTextureBatch(batch, (batch->maxVertices / 4) * 2);
+}
+
+static sg_buffer NextFlushBuffer(MisoTextureBatch *batch) {
+    // A buffer can only be updated once per frame, so further flushes in the
+    // same frame each get a spare buffer of the same size
+    if (batch->flushFrame != state.frame) {
+        batch->flushFrame = state.frame;
+        batch->flushCount = 0;
+    }
+    int index = batch->flushCount++;
+    if (!index)
+        return batch->bind.vertex_buffers[0];
+    while (index > batch->spillCount) {
+        batch->spillBuffers = realloc(batch->spillBuffers, (batch->spillCount + 1) * sizeof(sg_buffer));
+        sg_buffer_desc desc = {
+            .usage = SG_USAGE_STREAM,
+            .size = (batch->maxVertices / 4) * QuadSize(batch->format)
+        };
+        batch->spillBuffers[batch->spillCount++] = sg_make_buffer(&desc);
+    }
+    return batch->spillBuffers[index - 1];
+}
+
+static void GenerateSpriteInstance(MisoVec2 position, MisoVec2 textureSize, MisoVec2 size, MisoVec2 scale, MisoVec2 viewportSize, float rotation, MisoRect clip, float depth, MisoSpriteInstance *out) {
+    // GenerateQuad scales around the centre of the viewport in NDC, here that is
+    // folded into the sprite rect and then mapped into the framebuffer's pixels
+    // so every sprite in a flush can share one transform
+    float rx = state.size.x / viewportSize.x;
+    float ry = state.size.y / viewportSize.y;
+    float cx = viewportSize.x / 2.f, cy = viewportSize.y / 2.f;
+    *out = (MisoSpriteInstance) {
+        .position = {
+            ((position.x - cx) * scale.x + cx) * rx,
+            ((position.y - cy) * scale.y + cy) * ry
+        },
+        .size = {size.x * scale.x * rx, size.y * scale.y * ry},
+        .clip = {
+            PackUnorm16(clip.x / textureSize.x),
+            PackUnorm16(clip.y / textureSize.y),
+            PackUnorm16((clip.x + clip.w) / textureSize.x),
+            PackUnorm16((clip.y + clip.h) / textureSize.y)
+        },
+        .color = {.rgba = -1},
+        .rotation = rotation,
+        .depth = depth
+    };
+}
+
+static void TextureBatchDraw(MisoTextureBatch *batch, MisoVec2 position, MisoVec2 size, MisoVec2 scale, MisoVec2 viewportSize, float rotation, MisoRect clip, float depth) {
+    MakeRoomInTextureBatch(batch);
+    if (batch->format == MISO_VERTEX_INSTANCED)
+        GenerateSpriteInstance(position, batch->size, size, scale, viewportSize, rotation, clip, depth, (MisoSpriteInstance*)batch->vertices + batch->vertexCount / 4);
+    else if (batch->format == MISO_VERTEX_DEFAULT)
+        GenerateQuad(QuadViewport(scale, viewportSize), position, batch->size, size, rotation, clip, depth, (Quad*)batch->vertices + batch->vertexCount / 4);
+    else {
+        Quad quad;
+        GenerateQuad(QuadViewport(scale, viewportSize), position, batch->size, size, rotation, clip, depth, &quad);
+        StoreQuad(batch->format, batch->vertices, batch->vertexCount / 4, &quad);
+    }
+    batch->vertexCount += 4;
+}
+
+void MisoTextureBatchDraw(MisoTextureBatch *batch, MisoVec2 position, MisoVec2 size, MisoVec2 scale, MisoVec2 viewportSize, float rotation, MisoRect clip) {
+    TextureBatchDraw(batch, position, size, scale, viewportSize, rotation, clip, 0.f);
+}
+
+void MisoTextureBatchDrawTexture(MisoTextureBatch *batch, MisoTexture *texture, MisoVec2 position, MisoVec2 size, MisoVec2 scale, MisoVec2 viewportSize, float rotation, MisoRect clip) {
+    int slot = 0;
+    while (slot < batch->textureCount && batch->textures[slot] != texture)
+        slot++;
+    assert(slot < batch->textureCount);
+    if (batch->format != MISO_VERTEX_MULTI) {
+        MisoTextureBatchDraw(batch, position, size, scale, viewportSize, rotation, clip);
+        return;
+    }
+    MakeRoomInTextureBatch(batch);
+    Quad quad;
+    GenerateQuad(QuadViewport(scale, viewportSize), position, (MisoVec2){texture->w, texture->h}, size, rotation, clip, 0.f, &quad);
+    StoreMultiQuad(batch->vertices, batch->vertexCount / 4, &quad, slot);
+    batch->vertexCount += 4;
+}
+
+void MisoTextureBatchDrawSprites(MisoTextureBatch *batch, const MisoSprite *sprites, int count, MisoVec2 scale, MisoVec2 viewportSize) {
+    if (!batch->flushWhenFull && batch->vertexCount + count * 4 > batch->maxVertices)
+        ReserveTextureBatch(batch, MAX(batch->vertexCount / 4 + count, (batch->maxVertices / 4) * 2));
+    while (count > 0) {
+        MakeRoomInTextureBatch(batch);
+        int n = MIN(count, (batch->maxVertices - batch->vertexCount) / 4);
+        int first = batch->vertexCount / 4;
+        switch (batch->format) {
+            case MISO_VERTEX_DEFAULT:
+                GenerateQuads(sprites, n, batch->size, scale, viewportSize, (Quad*)batch->vertices + first);
+                break;
+            case MISO_VERTEX_COMPACT:
+            case MISO_VERTEX_MULTI:
+                for (int i = 0; i < n; i += 64) {
+                    Quad quads[64];
+                    int m = MIN(64, n - i);
+                    GenerateQuads(sprites + i, m, batch->size, scale, viewportSize, quads);
+                    for (int j = 0; j < m; j++)
+                        StoreQuad(batch->format, batch->vertices, first + i + j, &quads[j]);
+                }
+                break;
+            case MISO_VERTEX_INSTANCED:
+                for (int i = 0; i < n; i++)
+                    GenerateSpriteInstance(sprites[i].position, batch->size, sprites[i].size, scale, viewportSize, sprites[i].rotation, sprites[i].clip, sprites[i].depth, (MisoSpriteInstance*)batch->vertices + first + i);
+                break;
+            default:
+                assert(0);
+        }
+        batch->vertexCount += n * 4;
+        sprites += n;
+        count -= n;
+    }
+}
+
+static sg_buffer UploadTextureBatch(MisoTextureBatch *batch) {
+    sg_range range = {
+        .ptr = batch->vertices,
+        .size = (batch->vertexCount / 4) * QuadSize(batch->format)
+    };
+    sg_buffer buffer = NextFlushBuffer(batch);
+    sg_update_buffer(buffer, &range);
+    ApplyTexturePipeline(batch->format, batch->indexType, batch->alphaCutoff);
+    if (batch->format == MISO_VERTEX_INSTANCED) {
+        vs_params_t params = PixelTransform();
+        ApplyTransform(&params);
+    } else
+        ApplyTransform(&IdentityTransform);
+    return buffer;
+}
+
+static void DrawTextureBatchRange(MisoTextureBatch *batch, sg_buffer buffer, MisoTexture *texture, int first, int count) {
+    // Draws quads [first, first + count) of an uploaded batch with the given texture
+    if (batch->format == MISO_VERTEX_INSTANCED) {
+        sg_bindings bind = {
+            .vertex_buffers = {
+                [0] = state.quad_corners,
+                [1] = buffer
+            },
+            .vertex_buffer_offsets[1] = first * QuadSize(batch->format),
+            .index_buffer = state.quad_indices,
+            .fs_images[SLOT_tex] = texture->sg
+        };
+        sg_apply_bindings(&bind);
+        sg_draw(0, 6, count);
+    } else {
+        sg_bindings bind = batch->bind;
+        bind.vertex_buffers[0] = buffer;
+        if (batch->format != MISO_VERTEX_MULTI)
+            bind.fs_images[SLOT_tex] = texture->sg;
+        sg_apply_bindings(&bind);
+        sg_draw(first * 6, count * 6, 1);
+    }
+}
+
+void MisoFlushTextureBatch(MisoTextureBatch *batch) {
+    if (!batch->vertexCount)
+        return;
+    sg_buffer buffer = UploadTextureBatch(batch);
+    DrawTextureBatchRange(batch, buffer, batch->texture, 0, batch->vertexCount / 4);
+    batch->vertexCount = 0;
+}
+
+void MisoDestroyTextureBatch(MisoTextureBatch *batch) {
+    if (batch) {
+        if (batch->vertices)
+            free(batch->vertices);
+        if (sg_query_buffer_state(batch->bind.vertex_buffers[0]) == SG_RESOURCESTATE_VALID)
+            sg_destroy_buffer(batch->bind.vertex_buffers[0]);
+        if (sg_query_buffer_state(batch->bind.index_buffer) == SG_RESOURCESTATE_VALID)
+            sg_destroy_buffer(batch->bind.index_buffer);
+        FreeSpillBuffers(batch);
+        free(batch);
+    }
+}
+
+MisoRenderQueue* MisoCreateRenderQueue(int maxItems, MisoVertexFormat format) {
+    // Multi batches have fixed sampler slots, the queue swaps textures between runs
+    assert(maxItems > 0 && format != MISO_VERTEX_MULTI);
+    MisoRenderQueue *result = malloc(sizeof(MisoRenderQueue));
+    memset(result, 0, sizeof(MisoRenderQueue));
+    result->capacity = maxItems;
+    result->items = malloc(maxItems * sizeof(MisoRenderItem));
+    result->keys = malloc(maxItems * sizeof(MisoRenderKey));
+    result->scratch = malloc(maxItems * sizeof(MisoRenderKey));
+    result->sprites = malloc(maxItems * sizeof(MisoSprite));
+    result->runs = malloc(maxItems * sizeof(MisoRenderRun));
+    result->format = format;
+    return result;
+}
+
+static uint64_t RenderKey(MisoTexture *texture, const MisoSprite *sprite, unsigned char layer) {
+    // layer:8 | depth:24 | texture:16 | unused:16
+    // Depth is inverted so far sprites come first and blend under near ones.
+    // Queued sprites don't write depth, so a higher layer is always drawn over
+    // a lower one whatever their depth, depth only still hides them behind tiles.
+    // The low 16 bits of a sokol id are its pool slot, unique between live images
+    float depth = MAX(0.f, MIN(1.f, sprite->depth));
+    uint64_t far = (uint64_t)((1.f - depth) * 0xFFFFFF);
+    return ((uint64_t)layer << 56) | (far << 32) | ((uint64_t)(texture->sg.id & 0xFFFF) << 16);
+}
+
+void MisoRenderQueuePush(MisoRenderQueue *queue, MisoTexture *texture, const MisoSprite *sprite, unsigned char layer) {
+    assert(texture && sprite);
+    if (queue->count == queue->capacity) {
+        queue->capacity *= 2;
+        queue->items = realloc(queue->items, queue->capacity * sizeof(MisoRenderItem));
+        queue->keys = realloc(queue->keys, queue->capacity * sizeof(MisoRenderKey));
+        queue->scratch = realloc(queue->scratch, queue->capacity * sizeof(MisoRenderKey));
+        queue->sprites = realloc(queue->sprites, queue->capacity * sizeof(MisoSprite));
+        queue->runs = realloc(queue->runs, queue->capacity * sizeof(MisoRenderRun));
+    }
+    queue->items[queue->count] = (MisoRenderItem) {
+        .texture = texture,
+        .sprite = *sprite
+    };
+    queue->keys[queue->count] = (MisoRenderKey) {
+        .key = RenderKey(texture, sprite, layer),
+        .item = queue->count
+    };
+    queue->count++;
+}
+
+static void SortRenderKeys(MisoRenderQueue *queue) {
+    // LSD radix sort, one byte per pass. All eight histograms are built in a
+    // single read and passes where every key has the same byte are skipped
+    int histogram[8][256];
+    memset(histogram, 0, sizeof(histogram));
+    for (int i = 0; i < queue->count; i++)
+        for (int b = 0; b < 8; b++)
+            histogram[b][(queue->keys[i].key >> (b * 8)) & 0xFF]++;
+    MisoRenderKey *src = queue->keys, *dst = queue->scratch;
+    for (int b = 0; b < 8; b++) {
+        int offset = 0;
+        bool trivial = false;
+        for (int i = 0; i < 256; i++) {
+            int n = histogram[b][i];
+            if (n == queue->count) {
+                trivial = true;
+                break;
+            }
+            histogram[b][i] = offset;
+            offset += n;
+        }
+        if (trivial)
+            continue;
+        for (int i = 0; i < queue->count; i++)
+            dst[histogram[b][(src[i].key >> (b * 8)) & 0xFF]++] = src[i];
+        MisoRenderKey *tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+    queue->keys = src;
+    queue->scratch = dst;
+}
+
+void MisoFlushRenderQueue(MisoRenderQueue *queue, MisoVec2 scale, MisoVec2 viewportSize) {
+    if (!queue->count)
+        return;
+    SortRenderKeys(queue);
+    MisoTexture *first = queue->items[queue->keys[0].item].texture;
+    // No alpha cutoff, so the batch blends in key order instead of depth testing
+    // sprites against each other
+    if (!queue->batch)
+        queue->batch = MisoMakeTextureBatch(&(MisoTextureBatchDesc) {
+            .texture = first,
+            .maxQuads = queue->count,
+            .format = queue->format,
+            .alphaCutoff = 0.f
+        });
+    MisoTextureBatch *batch = queue->batch;
+    MisoFlushTextureBatch(batch);
+    ReserveTextureBatch(batch, queue->count);
+    // Consecutive sprites sharing a texture form a run. Every run is generated
+    // into the one batch, uploaded once and drawn with a call per run
+    int runCount = 0;
+    for (int i = 0; i < queue->count;) {
+        MisoTexture *texture = queue->items[queue->keys[i].item].texture;
+        int n = 0;
+        for (; i < queue->count && queue->items[queue->keys[i].item].texture == texture; i++)
+            queue->sprites[n++] = queue->items[queue->keys[i].item].sprite;
+        batch->size = (MisoVec2){texture->w, texture->h};
+        queue->runs[runCount++] = (MisoRenderRun) {
+            .texture = texture,
+            .first = batch->vertexCount / 4,
+            .count = n
+        };
+        MisoTextureBatchDrawSprites(batch, queue->sprites, n, scale, viewportSize);
+    }
+    batch->size = (MisoVec2){batch->texture->w, batch->texture->h};
+    sg_buffer buffer = UploadTextureBatch(batch);
+    for (int i = 0; i < runCount; i++)
+        DrawTextureBatchRange(batch, buffer, queue->runs[i].texture, queue->runs[i].first, queue->runs[i].count);
+    batch->vertexCount = 0;
+    queue->count = 0;
+}
+
+void MisoDestroyRenderQueue(MisoRenderQueue *queue) {
+    if (queue) {
+        MisoDestroyTextureBatch(queue->batch);
+        free(queue->items);
+        free(queue->keys);
+        free(queue->scratch);
+        free(queue->sprites);
+        free(queue->runs);
+        free(queue);
+    }
+}
+
+// Static chunks are uploaded in bands of this many tiles, so an edit only
+// re-uploads the bands it touches
+#if !defined(MISO_CHUNK_BAND_WIDTH)
+#define MISO_CHUNK_BAND_WIDTH 16
+#endif
+#if !defined(MISO_CHUNK_BAND_HEIGHT)
+#define MISO_CHUNK_BAND_HEIGHT 16
+#endif
+
+static void ResetChunkDirty(MisoChunk *chunk) {
+    int bands = ((chunk->w + MISO_CHUNK_BAND_WIDTH - 1) / MISO_CHUNK_BAND_WIDTH) * ((chunk->h + MISO_CHUNK_BAND_HEIGHT - 1) / MISO_CHUNK_BAND_HEIGHT);
+    memset(chunk->dirtyBands, 0, ((bands + 63) / 64) * sizeof(uint64_t));
+    chunk->dirtyBandCount = 0;
+}
+
+static void MarkChunkDirty(MisoChunk *chunk, int x0, int y0, int x1, int y1) {
+    // One bit per band, in the same order as the static chunk's buffers
+    chunk->lodDirty = true;
+    int bandsY = (chunk->h + MISO_CHUNK_BAND_HEIGHT - 1) / MISO_CHUNK_BAND_HEIGHT;
+    for (int bx = x0 / MISO_CHUNK_BAND_WIDTH; bx <= x1 / MISO_CHUNK_BAND_WIDTH; bx++)
+        for (int by = y0 / MISO_CHUNK_BAND_HEIGHT; by <= y1 / MISO_CHUNK_BAND_HEIGHT; by++) {
+            int bit = bx * bandsY + by;
+            uint64_t mask = 1ULL << (bit % 64);
+            if (!(chunk->dirtyBands[bit / 64] & mask)) {
+                chunk->dirtyBands[bit / 64] |= mask;
+                chunk->dirtyBandCount++;
+            }
+        }
+}
+
+static MisoTileTemplate* BakeTileTemplates(MisoVec2 size, float tileW, float tileH, int *count) {
+    // Tile IDs index a single row of tiles in the tileset. Each one is baked
+    // once into corner offsets and texcoords, so meshing a tile is a lookup
+    // and a translation instead of a clip rect and two divisions per corner
+    *count = (int)(size.x / tileW);
+    MisoTileTemplate *result = malloc(*count * sizeof(MisoTileTemplate));
+    for (int i = 0; i < *count; i++) {
+        MisoTileTemplate *tile = &result[i];
+        tile->clip = (MisoRect){i * tileW, 0, tileW, tileH};
+        Quad quad;
+        GenerateWorldQuad((MisoVec2){0, 0}, size, (MisoVec2){tileW, tileH}, tile->clip, 0.f, &quad);
+        for (int j = 0; j < 4; j++) {
+            tile->offset[j] = quad[j].position;
+            tile->texcoord[j] = quad[j].texcoord;
+            tile->packed[j][0] = PackUnorm16(quad[j].texcoord.x);
+            tile->packed[j][1] = PackUnorm16(quad[j].texcoord.y);
+        }
+    }
+    return result;
+}
+
+static void StoreTile(MisoVertexFormat format, void *vertices, int index, const MisoTileTemplate *tile, const MisoVec2 corners[4], float depth) {
+    switch (format) {
+        case MISO_VERTEX_DEFAULT:
+            for (int j = 0; j < 4; j++)
+                ((MisoVertex*)vertices)[index * 4 + j] = (MisoVertex) {
+                    .position = corners[j],
+                    .texcoord = tile->texcoord[j],
+                    .color = {1.f, 1.f, 1.f, 1.f},
+                    .depth = depth
+                };
+            break;
+        case MISO_VERTEX_COMPACT:
+            for (int j = 0; j < 4; j++)
+                ((MisoCompactVertex*)vertices)[index * 4 + j] = (MisoCompactVertex) {
+                    .position = corners[j],
+                    .texcoord = {tile->packed[j][0], tile->packed[j][1]},
+                    .color = {.rgba = -1},
+                    .depth = depth
+                };
+            break;
+        case MISO_VERTEX_MULTI:
+            for (int j = 0; j < 4; j++)
+                ((MisoMultiVertex*)vertices)[index * 4 + j] = (MisoMultiVertex) {
+                    .position = corners[j],
+                    .texcoord = tile->texcoord[j],
+                    .color = {.rgba = -1},
+                    .slot = 0.f,
+                    .depth = depth
+                };
+            break;
+        default:
+            assert(0);
+    }
+}
+
+static MisoChunk* NewChunk(MisoTextureBatch *batch, bool ownsBatch, int w, int h, int tileW, int tileH, MisoCellFormat cellFormat) {
+    assert(!(w % tileH));
+    MisoChunk *result = malloc(sizeof(MisoChunk));
+    result->batch = batch;
+    result->ownsBatch = ownsBatch;
+    result->tiles = BakeTileTemplates(batch->size, tileW, tileH, &result->tileCount);
+    switch (cellFormat) {
+        case MISO_CELL_DEFAULT:
+            result->cellSize = result->tileCount <= 256 ? 1 : result->tileCount <= 65536 ? 2 : 4;
+            break;
+        case MISO_CELL_8:
+            result->cellSize = 1;
+            break;
+        case MISO_CELL_16:
+            result->cellSize = 2;
+            break;
+        case MISO_CELL_32:
+            result->cellSize = 4;
+            break;
+        default:
+            assert(0);
+    }
+    // Every tile ID has to fit in a cell
+    assert(result->cellSize == 4 || result->tileCount <= 1 << (result->cellSize * 8));
+    size_t sz = w * h * result->cellSize;
+    result->grid = malloc(sz);
+    memset(result->grid, 0, sz);
+    result->w = w;
+    result->h = h;
+    result->tileW = tileW;
+    result->tileH = tileH;
+    result->originX = 0;
+    result->originY = 0;
+    result->emittedTiles = 0;
+    result->culledTiles = 0;
+    result->isStatic = false;
+    result->staticVertices = NULL;
+    result->staticBands = NULL;
+    result->staticBandCount = 0;
+    result->staticIndices = (sg_buffer){0};
+    result->updatedFrame = 0;
+    result->cached = false;
+    result->lodScale = 0.f;
+    result->lodGeneration = 0;
+    result->lodDirty = true;
+    result->lodTarget = (MisoTexture){0};
+    result->lodAtlas = NULL;
+    result->cacheFailed = false;
+    result->layers = NULL;
+    result->layerCount = 0;
+    int bands = ((w + MISO_CHUNK_BAND_WIDTH - 1) / MISO_CHUNK_BAND_WIDTH) * ((h + MISO_CHUNK_BAND_HEIGHT - 1) / MISO_CHUNK_BAND_HEIGHT);
+    result->dirtyBands = malloc(((bands + 63) / 64) * sizeof(uint64_t));
+    ResetChunkDirty(result);
+    return result;
+}
+
+MisoChunk* MisoMakeChunk(MisoChunkDesc *desc) {
+    // Tiles are always white and clipped inside the tileset, so nothing is lost packing them
+    MisoTextureBatchDesc batchDesc = {
+        .texture = desc->texture,
+        .maxQuads = desc->w * desc->h,
+        .format = MISO_VERTEX_COMPACT,
+        .alphaCutoff = MISO_TILE_ALPHA_CUTOFF
+    };
+    return NewChunk(MisoMakeTextureBatch(&batchDesc), true, desc->w, desc->h, desc->tileW, desc->tileH, desc->cellFormat);
+}
+
+MisoChunk* MisoEmptyChunk(MisoTexture *texture, int w, int h, int tileW, int tileH) {
+    MisoChunkDesc desc = {
+        .texture = texture,
+        .w = w,
+        .h = h,
+        .tileW = tileW,
+        .tileH = tileH
+    };
+    return MisoMakeChunk(&desc);
+}
+
+static int ChunkCell(MisoChunk *chunk, int index) {
+    switch (chunk->cellSize) {
+        case 1:
+            return ((uint8_t*)chunk->grid)[index];
+        case 2:
+            return ((uint16_t*)chunk->grid)[index];
+        default:
+            return ((int*)chunk->grid)[index];
+    }
+}
+
+int MisoChunkAt(MisoChunk *chunk, int x, int y) {
+    assert(x >= 0 && x < chunk->w && y >= 0 && y < chunk->h);
+    return ChunkCell(chunk, y * chunk->w + x);
+}
+
+void MisoChunkSet(MisoChunk *chunk, int x, int y, int value) {
+    assert(x >= 0 && x < chunk->w && y >= 0 && y < chunk->h);
+    assert(value >= 0 && value < chunk->tileCount);
+    int index = y * chunk->w + x;
+    if (ChunkCell(chunk, index) == value)
+        return;
+    switch (chunk->cellSize) {
+        case 1:
+            ((uint8_t*)chunk->grid)[index] = value;
+            break;
+        case 2:
+            ((uint16_t*)chunk->grid)[index] = value;
+            break;
+        default:
+            ((int*)chunk->grid)[index] = value;
+            break;
+    }
+    MarkChunkDirty(chunk, x, y, x, y);
+}
+
+static int PopCount64(uint64_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(v);
+#else
+    v = v - ((v >> 1) & 0x5555555555555555ULL);
+    v = (v & 0x3333333333333333ULL) + ((v >> 2) & 0x3333333333333333ULL);
+    v = (v + (v >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return (int)((v * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+static int TrailingZeros64(uint64_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(v);
+#else
+    return PopCount64((v & -v) - 1);
+#endif
+}
+
+static MisoChunkLayer* ChunkLayer(MisoChunk *chunk, int layer) {
+    // Layer 0 is the chunk's own grid, the rest are stacked on top of it
+    assert(layer > 0 && layer <= chunk->layerCount);
+    return &chunk->layers[layer - 1];
+}
+
+int MisoChunkAddLayer(MisoChunk *chunk, MisoTexture *texture) {
+    assert(texture);
+    chunk->layers = realloc(chunk->layers, (chunk->layerCount + 1) * sizeof(MisoChunkLayer));
+    MisoChunkLayer *layer = &chunk->layers[chunk->layerCount++];
+    // Layers start out with a small batch, it only grows when tiles are actually visible
+    MisoTextureBatchDesc desc = {
+        .texture = texture,
+        .maxQuads = 64,
+        .format = chunk->batch->format,
+        .alphaCutoff = MISO_TILE_ALPHA_CUTOFF
+    };
+    layer->batch = MisoMakeTextureBatch(&desc);
+    layer->tiles = BakeTileTemplates(layer->batch->size, chunk->tileW, chunk->tileH, &layer->tileCount);
+    // Occupancy is stored column by column, the same order tiles are meshed in.
+    // Only occupied cells have a value, found by counting the set bits before
+    // them, so an empty layer costs a bit and a half per cell
+    size_t words = (chunk->w * chunk->h + 63) / 64;
+    layer->occupancy = malloc(words * sizeof(uint64_t));
+    memset(layer->occupancy, 0, words * sizeof(uint64_t));
+    layer->ranks = malloc(words * sizeof(int));
+    memset(layer->ranks, 0, words * sizeof(int));
+    layer->values = NULL;
+    layer->occupied = layer->capacity = 0;
+    layer->visible = true;
+    chunk->lodDirty = true;
+    return chunk->layerCount;
+}
+
+static int LayerRank(MisoChunkLayer *layer, int bit) {
+    // Number of occupied cells before this one, which is also its value's index
+    return layer->ranks[bit / 64] + PopCount64(layer->occupancy[bit / 64] & ((1ULL << (bit % 64)) - 1));
+}
+
+int MisoChunkLayerAt(MisoChunk *chunk, int layer, int x, int y) {
+    if (!layer)
+        return MisoChunkAt(chunk, x, y);
+    assert(x >= 0 && x < chunk->w && y >= 0 && y < chunk->h);
+    MisoChunkLayer *l = ChunkLayer(chunk, layer);
+    int bit = x * chunk->h + y;
+    return l->occupancy[bit / 64] & (1ULL << (bit % 64)) ? l->values[LayerRank(l, bit)] : -1;
+}
+
+void MisoChunkLayerSet(MisoChunk *chunk, int layer, int x, int y, int value) {
+    // A negative value empties the cell, the ground layer can't be emptied
+    if (!layer) {
+        MisoChunkSet(chunk, x, y, value);
+        return;
+    }
+    assert(x >= 0 && x < chunk->w && y >= 0 && y < chunk->h);
+    MisoChunkLayer *l = ChunkLayer(chunk, layer);
+    assert(value < l->tileCount);
+    int bit = x * chunk->h + y;
+    uint64_t mask = 1ULL << (bit % 64);
+    bool was = (l->occupancy[bit / 64] & mask) != 0;
+    int rank = LayerRank(l, bit);
+    // Rewriting what's already there leaves any baked impostor valid
+    if (was == (value >= 0)) {
+        if (was && l->values[rank] != value) {
+            l->values[rank] = value;
+            chunk->lodDirty = true;
+        }
+        return;
+    }
+    chunk->lodDirty = true;
+    int words = (chunk->w * chunk->h + 63) / 64;
+    if (value < 0) {
+        memmove(l->values + rank, l->values + rank + 1, (l->occupied - rank - 1) * sizeof(int));
+        l->occupancy[bit / 64] &= ~mask;
+        l->occupied--;
+        for (int i = bit / 64 + 1; i < words; i++)
+            l->ranks[i]--;
+    } else {
+        if (l->occupied == l->capacity) {
+            l->capacity = MAX(16, l->capacity * 2);
+            l->values = realloc(l->values, l->capacity * sizeof(int));
+        }
+        memmove(l->values + rank + 1, l->values + rank, (l->occupied - rank) * sizeof(int));
+        l->values[rank] = value;
+        l->occupancy[bit / 64] |= mask;
+        l->occupied++;
+        for (int i = bit / 64 + 1; i < words; i++)
+            l->ranks[i]++;
+    }
+}
+
+void MisoChunkClearLayer(MisoChunk *chunk, int layer) {
+    MisoChunkLayer *l = ChunkLayer(chunk, layer);
+    int words = (chunk->w * chunk->h + 63) / 64;
+    memset(l->occupancy, 0, words * sizeof(uint64_t));
+    memset(l->ranks, 0, words * sizeof(int));
+    chunk->lodDirty |= l->occupied != 0;
+    l->occupied = 0;
+}
+
+void MisoChunkSetLayerVisible(MisoChunk *chunk, int layer, bool visible) {
+    MisoChunkLayer *l = ChunkLayer(chunk, layer);
+    chunk->lodDirty |= l->visible != visible;
+    l->visible = visible;
+}
+
+static int CountLayerColumn(MisoChunk *chunk, MisoChunkLayer *layer, int x, int y0, int y1) {
+    // Occupied cells in rows [y0, y1] of column x
+    int first = x * chunk->h + y0, last = x * chunk->h + y1;
+    int result = 0;
+    for (int word = first / 64; word <= last / 64; word++) {
+        uint64_t bits = layer->occupancy[word];
+        if (word == first / 64)
+            bits &= ~0ULL << (first % 64);
+        if (word == last / 64 && last % 64 != 63)
+            bits &= (1ULL << (last % 64 + 1)) - 1;
+        result += PopCount64(bits);
+    }
+    return result;
+}
+
+static MisoVec2 ChunkTileToWorld(MisoChunk *chunk, int x, int y) {
+    // Top left corner of the tile in world space
+    x += chunk->originX;
+    y += chunk->originY;
+    return (MisoVec2) {
+        ((float)x * chunk->tileW) + (y % 2 ? chunk->tileW / 2.f : 0),
+        (float)y * (chunk->tileH / 2.f)
+    };
+}
+
+static MisoVec2 ChunkTileToScreen(MisoChunk *chunk, MisoCamera *camera, int x, int y) {
+    // Centre of the tile in screen pixels, expects the camera to be up to date
+    MisoVec2 origin = ChunkTileToWorld(chunk, x, y);
+    return TransformPoint(&camera->worldToScreen, (MisoVec2){origin.x + chunk->tileW / 2.f, origin.y + chunk->tileH / 2.f});
+}
+
+static bool ChunkVisibleRange(MisoChunk *chunk, MisoCamera *camera, int *x0, int *y0, int *x1, int *y1) {
+    MisoUpdateCamera(camera);
+    MisoVec2 topLeft = TransformPoint(&camera->screenToWorld, (MisoVec2){0.f, 0.f});
+    MisoVec2 bottomRight = TransformPoint(&camera->screenToWorld, state.size);
+    MisoVec2 origin = ChunkTileToWorld(chunk, 0, 0);
+    float halfTileH = chunk->tileH / 2.f;
+    // Measured from the centre of the first tile; pad by a whole tile to account
+    // for the half tile stagger on odd rows
+    origin.x += chunk->tileW / 2.f;
+    origin.y += halfTileH;
+    float left   = topLeft.x - origin.x - chunk->tileW;
+    float right  = bottomRight.x - origin.x + chunk->tileW;
+    float top    = topLeft.y - origin.y - chunk->tileH;
+    float bottom = bottomRight.y - origin.y + chunk->tileH;
+    *x0 = MAX((int)floorf(left / chunk->tileW), 0);
+    *x1 = MIN((int)ceilf(right / chunk->tileW), chunk->w - 1);
+    *y0 = MAX((int)floorf(top / halfTileH), 0);
+    *y1 = MIN((int)ceilf(bottom / halfTileH), chunk->h - 1);
+    return *x0 <= *x1 && *y0 <= *y1;
+}
+
+void MisoDrawChunkCustom(MisoChunk *chunk, MisoCamera *camera, void(*Callback)(MisoChunk*, MisoCamera*, MisoVec2, MisoVec2)) {
+    int x0, y0, x1, y1;
+    chunk->emittedTiles = 0;
+    chunk->culledTiles = chunk->w * chunk->h;
+    if (!ChunkVisibleRange(chunk, camera, &x0, &y0, &x1, &y1))
+        return;
+    for (int x = x0; x <= x1; x++)
+        for (int y = y0; y <= y1; y++)
+            Callback(chunk, camera, ChunkTileToScreen(chunk, camera, x, y), (MisoVec2){x, y});
+    chunk->emittedTiles = (x1 - x0 + 1) * (y1 - y0 + 1);
+    chunk->culledTiles -= chunk->emittedTiles;
+}
+
+static void MeshScreenTile(MisoChunk *chunk, MisoTextureBatch *batch, MisoCamera *camera, MisoVec2 origin, const MisoTileTemplate *tile, float depth, int index) {
+    // origin is the tile's top left corner in world space. This runs on the
+    // meshing jobs, so the camera has to be up to date already
+    if (batch->format == MISO_VERTEX_INSTANCED) {
+        MisoVec2 position = TransformPoint(&camera->worldToScreen, origin);
+        MisoVec2 size = {chunk->tileW * camera->zoom, chunk->tileH * camera->zoom};
+        GenerateSpriteInstance(position, batch->size, size, (MisoVec2){1.f, 1.f}, state.size, 0.f, tile->clip, depth, (MisoSpriteInstance*)batch->vertices + index);
+        return;
+    }
+    // The camera never rotates, so the corners are just scaled offsets from the origin
+    const MisoTransform *clip = &camera->worldToClip;
+    MisoVec2 base = TransformPoint(clip, origin);
+    MisoVec2 corners[4];
+    for (int j = 0; j < 4; j++)
+        corners[j] = (MisoVec2){base.x + clip->x[0] * tile->offset[j].x, base.y + clip->y[1] * tile->offset[j].y};
+    StoreTile(batch->format, batch->vertices, index, tile, corners, depth);
+}
+
+static void DrawChunkDefault(MisoChunk *chunk, MisoCamera *camera, MisoVec2 position, MisoVec2 gridPosition) {
+    // Tiles are placed from their grid position, the screen position is only
+    // there for custom draw callbacks
+    (void)position;
+    MakeRoomInTextureBatch(chunk->batch);
+    int x = gridPosition.x, y = gridPosition.y;
+    MeshScreenTile(chunk, chunk->batch, camera, ChunkTileToWorld(chunk, x, y), &chunk->tiles[MisoChunkAt(chunk, x, y)], MisoIsoDepth(chunk->originY + y, 0.f), chunk->batch->vertexCount / 4);
+    chunk->batch->vertexCount += 4;
+}
+
+static int StaticBandStart(MisoChunk *chunk, int bx, int by) {
+    // Bands are stored column of bands by column of bands, each one's tiles
+    // x-outer, y-inner. Only the last band of a row or column is cut short
+    int x = bx * MISO_CHUNK_BAND_WIDTH, y = by * MISO_CHUNK_BAND_HEIGHT;
+    return x * chunk->h + y * MIN(MISO_CHUNK_BAND_WIDTH, chunk->w - x);
+}
+
+static int StaticTileIndex(MisoChunk *chunk, int x, int y) {
+    int bx = x / MISO_CHUNK_BAND_WIDTH, by = y / MISO_CHUNK_BAND_HEIGHT;
+    int rows = MIN(MISO_CHUNK_BAND_HEIGHT, chunk->h - by * MISO_CHUNK_BAND_HEIGHT);
+    return StaticBandStart(chunk, bx, by) + (x - bx * MISO_CHUNK_BAND_WIDTH) * rows + y - by * MISO_CHUNK_BAND_HEIGHT;
+}
+
+static void MeshWorldTile(MisoChunk *chunk, int x, int y, int cell) {
+    const MisoTileTemplate *tile = &chunk->tiles[cell];
+    MisoVec2 origin = ChunkTileToWorld(chunk, x, y);
+    MisoVec2 corners[4];
+    for (int j = 0; j < 4; j++)
+        corners[j] = (MisoVec2){origin.x + tile->offset[j].x, origin.y + tile->offset[j].y};
+    StoreTile(chunk->batch->format, chunk->staticVertices, StaticTileIndex(chunk, x, y), tile, corners, MisoIsoDepth(chunk->originY + y, 0.f));
+}
+
+// Roughly how many tiles one meshing job covers
+#if !defined(MISO_MESH_JOB_TILES)
+#define MISO_MESH_JOB_TILES 1024
+#endif
+
+typedef struct {
+    MisoChunk *chunk;
+    MisoCamera *camera;
+    // NULL when meshing the chunk's static vertices
+    MisoTextureBatch *batch;
+    int x0, y0, x1, y1, base;
+} ChunkMesh;
+
+typedef struct {
+    ChunkMesh *mesh;
+    int first, last;
+} ChunkMeshBand;
+
+static void MeshChunkTile(ChunkMesh *mesh, int x, int y, int cell) {
+    if (mesh->batch)
+        MeshScreenTile(mesh->chunk, mesh->batch, mesh->camera, ChunkTileToWorld(mesh->chunk, x, y), &mesh->chunk->tiles[cell], MisoIsoDepth(mesh->chunk->originY + y, 0.f), mesh->base + (x - mesh->x0) * (mesh->y1 - mesh->y0 + 1) + (y - mesh->y0));
+    else
+        MeshWorldTile(mesh->chunk, x, y, cell);
+}
+
+// One band's loop for one cell width, so reading a cell is a plain load
+#define MESH_CHUNK_BAND(TYPE)                                        \
+do {                                                                 \
+    const TYPE *grid = mesh->chunk->grid;                            \
+    for (int x = band->first; x <= band->last; x++)                  \
+        for (int y = mesh->y0; y <= mesh->y1; y++)                   \
+            MeshChunkTile(mesh, x, y, grid[y * mesh->chunk->w + x]); \
+} while(0)
+
+static void MeshChunkBand(void *userdata, int index) {
+    // Tiles keep the x-outer, y-inner order of MisoDrawChunkCustom, so every
+    // band of columns owns a disjoint range of the vertex array
+    ChunkMeshBand *band = (ChunkMeshBand*)userdata + index;
+    ChunkMesh *mesh = band->mesh;
+    switch (mesh->chunk->cellSize) {
+        case 1:
+            MESH_CHUNK_BAND(uint8_t);
+            break;
+        case 2:
+            MESH_CHUNK_BAND(uint16_t);
+            break;
+        default:
+            MESH_CHUNK_BAND(int);
+            break;
+    }
+}
+
+static void MeshChunks(ChunkMesh *meshes, int count) {
+    int bandCount = 0;
+    for (int i = 0; i < count; i++) {
+        int width = MAX(1, MISO_MESH_JOB_TILES / (meshes[i].y1 - meshes[i].y0 + 1));
+        bandCount += (meshes[i].x1 - meshes[i].x0 + width) / width;
+    }
+    ChunkMeshBand *bands = malloc(bandCount * sizeof(ChunkMeshBand));
+    for (int i = 0, n = 0; i < count; i++) {
+        int width = MAX(1, MISO_MESH_JOB_TILES / (meshes[i].y1 - meshes[i].y0 + 1));
+        for (int x = meshes[i].x0; x <= meshes[i].x1; x += width)
+            bands[n++] = (ChunkMeshBand) {
+                .mesh = &meshes[i],
+                .first = x,
+                .last = MIN(meshes[i].x1, x + width - 1)
+            };
+    }
+    MisoParallelFor(bandCount, MeshChunkBand, bands);
+    free(bands);
+}
+
+static bool ClaimChunkMesh(MisoChunk *chunk, MisoCamera *camera, MisoTextureBatch *batch, ChunkMesh *mesh) {
+    // Takes the visible tiles' range of the batch, the caller makes room for it first
+    int x0, y0, x1, y1;
+    chunk->emittedTiles = 0;
+    chunk->culledTiles = chunk->w * chunk->h;
+    if (!ChunkVisibleRange(chunk, camera, &x0, &y0, &x1, &y1))
+        return false;
+    int tiles = (x1 - x0 + 1) * (y1 - y0 + 1);
+    assert(batch->vertexCount + tiles * 4 <= batch->maxVertices);
+    *mesh = (ChunkMesh) {
+        .chunk = chunk,
+        .camera = camera,
+        .batch = batch,
+        .x0 = x0, .y0 = y0, .x1 = x1, .y1 = y1,
+        .base = batch->vertexCount / 4
+    };
+    batch->vertexCount += tiles * 4;
+    chunk->emittedTiles = tiles;
+    chunk->culledTiles -= tiles;
+    return true;
+}
+
+typedef struct {
+    MisoChunk *chunk;
+    MisoCamera *camera;
+    int x0, y0, x1, y1, width, bands;
+    // Next quad of every layer's batch per band, followed by every band's
+    // position in each layer's values
+    int *cursors;
+} LayerMesh;
+
+static void MeshLayerBand(void *userdata, int band) {
+    // Only the set bits of the visible layers are walked, so empty stretches
+    // are skipped a word at a time. Every occupied cell works out its screen
+    // position once, for all of its layers
+    LayerMesh *mesh = userdata;
+    MisoChunk *chunk = mesh->chunk;
+    int *cursors = mesh->cursors + band * chunk->layerCount;
+    int *values = cursors + mesh->bands * chunk->layerCount;
+    int first = mesh->x0 + band * mesh->width, last = MIN(mesh->x1, first + mesh->width - 1);
+    for (int x = first; x <= last; x++) {
+        int start = x * chunk->h + mesh->y0, end = x * chunk->h + mesh->y1;
+        for (int i = 0; i < chunk->layerCount; i++)
+            if (chunk->layers[i].visible)
+                values[i] = LayerRank(&chunk->layers[i], start);
+        for (int word = start / 64; word <= end / 64; word++) {
+            uint64_t window = ~0ULL;
+            if (word == start / 64)
+                window &= ~0ULL << (start % 64);
+            if (word == end / 64 && end % 64 != 63)
+                window &= (1ULL << (end % 64 + 1)) - 1;
+            uint64_t cells = 0;
+            for (int i = 0; i < chunk->layerCount; i++)
+                if (chunk->layers[i].visible)
+                    cells |= chunk->layers[i].occupancy[word];
+            cells &= window;
+            while (cells) {
+                uint64_t mask = cells & -cells;
+                int y = word * 64 + TrailingZeros64(cells) - x * chunk->h;
+                cells ^= mask;
+                MisoVec2 position = ChunkTileToWorld(chunk, x, y);
+                float row = chunk->originY + y;
+                for (int i = 0; i < chunk->layerCount; i++) {
+                    MisoChunkLayer *layer = &chunk->layers[i];
+                    if (layer->visible && layer->occupancy[word] & mask)
+                        MeshScreenTile(chunk, layer->batch, mesh->camera, position, &layer->tiles[layer->values[values[i]++]], MisoIsoDepth(row, i + 1), cursors[i]++);
+                }
+            }
+        }
+    }
+}
+
+static void DrawChunkLayers(MisoChunk *chunk, MisoCamera *camera) {
+    // Layers with nothing in them are skipped before anything is culled or counted
+    bool any = false;
+    for (int i = 0; i < chunk->layerCount; i++)
+        any |= chunk->layers[i].visible && chunk->layers[i].occupied;
+    int x0, y0, x1, y1;
+    if (!any || !ChunkVisibleRange(chunk, camera, &x0, &y0, &x1, &y1))
+        return;
+    LayerMesh mesh = {
+        .chunk = chunk,
+        .camera = camera,
+        .x0 = x0, .y0 = y0, .x1 = x1, .y1 = y1,
+        .width = MAX(1, MISO_MESH_JOB_TILES / (y1 - y0 + 1))
+    };
+    int bands = mesh.bands = (x1 - x0 + mesh.width) / mesh.width;
+    mesh.cursors = malloc(2 * bands * chunk->layerCount * sizeof(int));
+    // Counting the occupied cells of every band up front gives each band its
+    // own range in every layer's batch
+    for (int i = 0; i < chunk->layerCount; i++) {
+        MisoChunkLayer *layer = &chunk->layers[i];
+        int total = 0;
+        for (int b = 0; b < bands; b++) {
+            mesh.cursors[b * chunk->layerCount + i] = total;
+            if (!layer->visible || !layer->occupied)
+                continue;
+            int first = x0 + b * mesh.width, last = MIN(x1, first + mesh.width - 1);
+            for (int x = first; x <= last; x++)
+                total += CountLayerColumn(chunk, layer, x, y0, y1);
+        }
+        if (!total)
+            continue;
+        MisoTextureBatch *batch = layer->batch;
+        ReserveTextureBatch(batch, batch->vertexCount / 4 + total);
+        for (int b = 0; b < bands; b++)
+            mesh.cursors[b * chunk->layerCount + i] += batch->vertexCount / 4;
+        batch->vertexCount += total * 4;
+    }
+    MisoParallelFor(bands, MeshLayerBand, &mesh);
+    free(mesh.cursors);
+    for (int i = 0; i < chunk->layerCount; i++)
+        MisoFlushTextureBatch(chunk->layers[i].batch);
+}
+
+static void FreeStaticChunk(MisoChunk *chunk) {
+    if (chunk->staticBands) {
+        for (int i = 0; i < chunk->staticBandCount; i++)
+            if (sg_query_buffer_state(chunk->staticBands[i]) == SG_RESOURCESTATE_VALID)
+                sg_destroy_buffer(chunk->staticBands[i]);
+        free(chunk->staticBands);
+        chunk->staticBands = NULL;
+    }
+    chunk->staticBandCount = 0;
+    if (sg_query_buffer_state(chunk->staticIndices) == SG_RESOURCESTATE_VALID)
+        sg_destroy_buffer(chunk->staticIndices);
+    chunk->staticIndices = (sg_buffer){0};
+    if (chunk->staticVertices) {
+        free(chunk->staticVertices);
+        chunk->staticVertices = NULL;
+    }
+}
+
+static void AllocStaticChunk(MisoChunk *chunk) {
+    assert(chunk->batch->format == MISO_VERTEX_DEFAULT || chunk->batch->format == MISO_VERTEX_COMPACT);
+    // sokol can only replace a whole buffer, so the geometry is split into
+    // bands that are each uploaded on their own when an edit touches them
+    int bandsX = (chunk->w + MISO_CHUNK_BAND_WIDTH - 1) / MISO_CHUNK_BAND_WIDTH;
+    int bandsY = (chunk->h + MISO_CHUNK_BAND_HEIGHT - 1) / MISO_CHUNK_BAND_HEIGHT;
+    size_t quadSize = QuadSize(chunk->batch->format);
+    chunk->staticBandCount = bandsX * bandsY;
+    chunk->staticBands = malloc(chunk->staticBandCount * sizeof(sg_buffer));
+    for (int bx = 0; bx < bandsX; bx++)
+        for (int by = 0; by < bandsY; by++) {
+            int columns = MIN(MISO_CHUNK_BAND_WIDTH, chunk->w - bx * MISO_CHUNK_BAND_WIDTH);
+            int rows = MIN(MISO_CHUNK_BAND_HEIGHT, chunk->h - by * MISO_CHUNK_BAND_HEIGHT);
+            sg_buffer_desc desc = {
+                .usage = SG_USAGE_DYNAMIC,
+                .size = columns * rows * quadSize
+            };
+            chunk->staticBands[bx * bandsY + by] = sg_make_buffer(&desc);
+        }
+    // The bands' own indices, the chunk batch's can shrink under them
+    int quads = MIN(MISO_CHUNK_BAND_WIDTH, chunk->w) * MIN(MISO_CHUNK_BAND_HEIGHT, chunk->h);
+    chunk->staticIndices = MakeQuadIndices(quads, &chunk->staticIndexType);
+    chunk->staticVertices = malloc(chunk->w * chunk->h * quadSize);
+    MarkChunkDirty(chunk, 0, 0, chunk->w - 1, chunk->h - 1);
+}
+
+void MisoUpdateChunk(MisoChunk *chunk) {
+    if (!chunk->isStatic)
+        return;
+    if (!chunk->staticVertices)
+        AllocStaticChunk(chunk);
+    // Buffers can only be updated once per frame, any further edits are picked up next frame
+    if (!chunk->dirtyBandCount || chunk->updatedFrame == state.frame)
+        return;
+    size_t quadSize = QuadSize(chunk->batch->format);
+    // Only the flagged bands are meshed and uploaded, each one is a
+    // contiguous range of the static vertices
+    int bandsY = (chunk->h + MISO_CHUNK_BAND_HEIGHT - 1) / MISO_CHUNK_BAND_HEIGHT;
+    ChunkMesh *meshes = malloc(chunk->dirtyBandCount * sizeof(ChunkMesh));
+    int count = 0;
+    for (int i = 0; i < chunk->staticBandCount; i++)
+        if (chunk->dirtyBands[i / 64] & (1ULL << (i % 64))) {
+            int bx = i / bandsY, by = i % bandsY;
+            meshes[count++] = (ChunkMesh) {
+                .chunk = chunk,
+                .x0 = bx * MISO_CHUNK_BAND_WIDTH,
+                .y0 = by * MISO_CHUNK_BAND_HEIGHT,
+                .x1 = MIN((bx + 1) * MISO_CHUNK_BAND_WIDTH, chunk->w) - 1,
+                .y1 = MIN((by + 1) * MISO_CHUNK_BAND_HEIGHT, chunk->h) - 1
+            };
+        }
+    MeshChunks(meshes, count);
+    for (int i = 0; i < count; i++) {
+        int bx = meshes[i].x0 / MISO_CHUNK_BAND_WIDTH, by = meshes[i].y0 / MISO_CHUNK_BAND_HEIGHT;
+        sg_range range = {
+            .ptr = (char*)chunk->staticVertices + StaticBandStart(chunk, bx, by) * quadSize,
+            .size = (meshes[i].x1 - meshes[i].x0 + 1) * (meshes[i].y1 - meshes[i].y0 + 1) * quadSize
+        };
+        sg_update_buffer(chunk->staticBands[bx * bandsY + by], &range);
+    }
+    free(meshes);
+    ResetChunkDirty(chunk);
+    chunk->updatedFrame = state.frame;
+}
+
+static void DrawStaticChunk(MisoChunk *chunk, MisoCamera *camera) {
+    MisoUpdateChunk(chunk);
+    int x0, y0, x1, y1;
+    chunk->emittedTiles = 0;
+    chunk->culledTiles = chunk->w * chunk->h;
+    if (!ChunkVisibleRange(chunk, camera, &x0, &y0, &x1, &y1))
+        return;
+    ApplyTexturePipeline(chunk->batch->format, chunk->staticIndexType, chunk->batch->alphaCutoff);
+    vs_params_t params = CameraTransform(camera);
+    ApplyTransform(&params);
+    sg_bindings bind = {
+        .index_buffer = chunk->staticIndices,
+        .fs_images[SLOT_tex] = chunk->batch->texture->sg
+    };
+    // Only bands in view are drawn, and only their visible columns. Rows
+    // within a band are left to the GPU to clip. Every band is a buffer of
+    // its own, so a static chunk costs one draw per visible band rather than
+    // one for the whole chunk. Raising MISO_CHUNK_BAND_WIDTH/HEIGHT trades
+    // fewer draws for bigger uploads
+    int bandsY = (chunk->h + MISO_CHUNK_BAND_HEIGHT - 1) / MISO_CHUNK_BAND_HEIGHT;
+    for (int bx = x0 / MISO_CHUNK_BAND_WIDTH; bx <= x1 / MISO_CHUNK_BAND_WIDTH; bx++) {
+        int first = MAX(bx * MISO_CHUNK_BAND_WIDTH, x0);
+        int last = MIN((bx + 1) * MISO_CHUNK_BAND_WIDTH - 1, x1);
+        for (int by = y0 / MISO_CHUNK_BAND_HEIGHT; by <= y1 / MISO_CHUNK_BAND_HEIGHT; by++) {
+            int rows = MIN(MISO_CHUNK_BAND_HEIGHT, chunk->h - by * MISO_CHUNK_BAND_HEIGHT);
+            bind.vertex_buffers[0] = chunk->staticBands[bx * bandsY + by];
+            sg_apply_bindings(&bind);
+            sg_draw((first - bx * MISO_CHUNK_BAND_WIDTH) * rows * 6, (last - first + 1) * rows * 6, 1);
+            chunk->emittedTiles += (last - first + 1) * rows;
+        }
+    }
+    chunk->culledTiles -= chunk->emittedTiles;
+}
+
+void MisoSetChunkStatic(MisoChunk *chunk, bool enabled) {
+    if (chunk->isStatic == enabled)
+        return;
+    chunk->isStatic = enabled;
+    if (!enabled)
+        FreeStaticChunk(chunk);
+}
+
+static sg_pass MakeRenderTarget(int width, int height, sg_image *color, sg_image *depth) {
+    // Depth is optional, targets without it need pipelines without it
+    sg_image_desc img_desc = {
+        .render_target = true,
+        .width = width,
+        .height = height,
+        .pixel_format = SG_PIXELFORMAT_RGBA8,
+        .min_filter = SG_FILTER_NEAREST,
+        .mag_filter = SG_FILTER_NEAREST,
+        .wrap_u = SG_WRAP_REPEAT,
+        .wrap_v = SG_WRAP_REPEAT
+    };
+    *color = sg_make_image(&img_desc);
+    sg_pass_desc pass_desc = {
+        .color_attachments[0].image = *color
+    };
+    if (depth) {
+        // 16 bit depth (the GL default) is too coarse for MisoIsoDepth
+        img_desc.pixel_format = SG_PIXELFORMAT_DEPTH_STENCIL;
+        *depth = sg_make_image(&img_desc);
+        pass_desc.depth_stencil_attachment.image = *depth;
+    }
+    return sg_make_pass(&pass_desc);
 }
+
+// Below this zoom chunks are drawn as a single quad from a baked impostor
+#if !defined(MISO_LOD_ZOOM)
+#define MISO_LOD_ZOOM .25f
 #endif
+// Atlas pixels per world pixel in a baked impostor
+#if !defined(MISO_LOD_SCALE)
+#define MISO_LOD_SCALE .125f
+#endif
+#if !defined(MISO_LOD_ATLAS_SIZE)
+#define MISO_LOD_ATLAS_SIZE 4096
+#endif
+// Most tiles baked into impostors per frame, anything over it waits a frame
+#if !defined(MISO_LOD_BAKE_TILES)
+#define MISO_LOD_BAKE_TILES 65536
+#endif
+
+static void ChunkWorldBounds(MisoChunk *chunk, MisoVec2 *origin, MisoVec2 *size) {
+    // Every tile of the chunk, including the odd row stagger
+    *origin = (MisoVec2){chunk->originX * chunk->tileW, chunk->originY * (chunk->tileH / 2.f)};
+    *size = (MisoVec2){chunk->w * chunk->tileW + chunk->tileW / 2.f, (chunk->h + 1) * (chunk->tileH / 2.f)};
+}
 
-typedef MisoVertex Quad[6];
+static bool ImpostorOwnTarget(MisoCamera *camera, bool cached) {
+    // Cached chunks are baked at the camera's zoom, far too big to share an atlas
+    return cached && camera->zoom >= MISO_LOD_ZOOM;
+}
 
-static void GenerateQuad(MisoVec2 position, MisoVec2 textureSize, MisoVec2 size, MisoVec2 scale, MisoVec2 viewportSize, float rotation, MisoRect clip, Quad *out) {
-    MisoVec2 quad[4] = {
-        {position.x, position.y + size.y}, // bottom left
-        {position.x + size.x, position.y + size.y}, // bottom right
-        {position.x + size.x, position.y }, // top right
-        {position.x, position.y }, // top left
+static float ImpostorScale(MisoChunk *chunk, MisoCamera *camera, bool cached) {
+    // Zoomed out impostors are baked small and scaled up a little, cached
+    // chunks are baked at the camera's zoom so they match their tiles pixel
+    // for pixel. 0 when the chunk can't have an impostor at this zoom
+    MisoVec2 origin, size;
+    ChunkWorldBounds(chunk, &origin, &size);
+    if (ImpostorOwnTarget(camera, cached)) {
+        float limit = (float)sg_query_limits().max_image_size_2d;
+        return camera->zoom <= MIN(limit / size.x, limit / size.y) ? camera->zoom : 0.f;
+    }
+    float fit = MIN((MISO_LOD_ATLAS_SIZE - 2) / size.x, (MISO_LOD_ATLAS_SIZE - 2) / size.y);
+    return camera->zoom < MISO_LOD_ZOOM ? MIN(MISO_LOD_SCALE, fit) : 0.f;
+}
+
+static MisoTexture* ImpostorAtlas(MisoChunk *chunk, MisoCamera *camera, bool cached) {
+    return ImpostorOwnTarget(camera, cached) ? &chunk->lodTarget : &state.lodTexture;
+}
+
+static void BeginImpostorPass(bool clear) {
+    if (sg_query_pass_state(state.lodPass) != SG_RESOURCESTATE_VALID) {
+        state.lodPass = MakeRenderTarget(MISO_LOD_ATLAS_SIZE, MISO_LOD_ATLAS_SIZE, &state.lodTexture.sg, NULL);
+        state.lodTexture.w = state.lodTexture.h = MISO_LOD_ATLAS_SIZE;
+        clear = true;
+    }
+    sg_pass_action action = {
+        .colors[0] = {
+            .action = clear ? SG_ACTION_CLEAR : SG_ACTION_LOAD,
+            .value = {0.f, 0.f, 0.f, 0.f}
+        }
     };
-    float vw =  2.f / (float)viewportSize.x;
-    float vh = -2.f / (float)viewportSize.y;
-    for (int j = 0; j < 4; j++)
-        quad[j] = (MisoVec2) {
-            (vw * quad[j].x + -1.f) * scale.x,
-            (vh * quad[j].y +  1.f) * scale.y
+    sg_begin_pass(state.lodPass, &action);
+    state.baking = true;
+}
+
+static void FreeChunkImpostor(MisoChunk *chunk) {
+    if (sg_query_image_state(chunk->lodTarget.sg) == SG_RESOURCESTATE_VALID)
+        sg_destroy_image(chunk->lodTarget.sg);
+    chunk->lodTarget = (MisoTexture){0};
+    if (chunk->lodAtlas == &chunk->lodTarget)
+        chunk->lodAtlas = NULL;
+}
+
+static int ImpostorTargetSize(int size) {
+    // Power of two sizes keep texcoords exact, like the shared atlas
+    int result = 1;
+    while (result < size)
+        result *= 2;
+    return MIN(result, sg_query_limits().max_image_size_2d);
+}
+
+static sg_pass BeginChunkImpostorPass(MisoChunk *chunk, int w, int h) {
+    // Only the target outlives the bake, there are far fewer passes to go
+    // around than chunks. It only ever grows, zooming back out reuses its corner
+    sg_pass pass;
+    if (sg_query_image_state(chunk->lodTarget.sg) != SG_RESOURCESTATE_VALID || w > chunk->lodTarget.w || h > chunk->lodTarget.h) {
+        w = ImpostorTargetSize(MAX(w, chunk->lodTarget.w));
+        h = ImpostorTargetSize(MAX(h, chunk->lodTarget.h));
+        FreeChunkImpostor(chunk);
+        pass = MakeRenderTarget(w, h, &chunk->lodTarget.sg, NULL);
+        chunk->lodTarget.w = w;
+        chunk->lodTarget.h = h;
+    } else {
+        sg_pass_desc desc = {
+            .color_attachments[0].image = chunk->lodTarget.sg
         };
-    
-    float iw = 1.f/textureSize.x, ih = 1.f/(float)textureSize.y;
-    float tl = clip.x*iw;
-    float tt = clip.y*ih;
-    float tr = (clip.x + clip.w)*iw;
-    float tb = (clip.y + clip.h)*ih;
-    MisoVec2 vtexquad[4] = {
-        {tl, tb}, // bottom left
-        {tr, tb}, // bottom right
-        {tr, tt}, // top right
-        {tl, tt}, // top left
-    };
-    static int indices[6] = {
-        0, 1, 2,
-        3, 0, 2
+        pass = sg_make_pass(&desc);
+    }
+    if (sg_query_pass_state(pass) != SG_RESOURCESTATE_VALID) {
+        // Out of images or passes, the chunk is drawn as tiles instead
+        FreeChunkImpostor(chunk);
+        if (sg_query_pass_state(pass) == SG_RESOURCESTATE_FAILED)
+            sg_destroy_pass(pass);
+        chunk->cacheFailed = true;
+        return (sg_pass){0};
+    }
+    sg_pass_action action = {
+        .colors[0] = {
+            .action = SG_ACTION_CLEAR,
+            .value = {0.f, 0.f, 0.f, 0.f}
+        }
     };
-    
-    for (int i = 0; i < 6; i++)
-        (*out)[i] = (MisoVertex) {
-            .position = quad[indices[i]],
-            .texcoord = vtexquad[indices[i]],
-            .color = {1.f, 1.f, 1.f, 1.f}
+    sg_begin_pass(pass, &action);
+    state.baking = true;
+    return pass;
+}
+
+static void EndImpostorPass(void) {
+    FlushImmediate();
+    sg_end_pass();
+    state.baking = false;
+}
+
+static bool PackImpostor(int w, int h, MisoRect *rect) {
+    // Shelf packing, a pixel of padding keeps neighbours from bleeding in
+    if (state.lodShelfX + w + 1 > MISO_LOD_ATLAS_SIZE) {
+        state.lodShelfY += state.lodShelfH;
+        state.lodShelfX = state.lodShelfH = 0;
+    }
+    if (state.lodShelfY + h + 1 > MISO_LOD_ATLAS_SIZE)
+        return false;
+    *rect = (MisoRect){state.lodShelfX + 1, state.lodShelfY + 1, w, h};
+    state.lodShelfX += w + 1;
+    state.lodShelfH = MAX(state.lodShelfH, h + 1);
+    return true;
+}
+
+static void BakeImpostorTile(MisoChunk *chunk, MisoTexture *texture, const MisoTileTemplate *tile, int x, int y, MisoVec2 origin, float scale) {
+    MisoVec2 position = ChunkTileToWorld(chunk, x, y);
+    MisoVec2 corners[4];
+    for (int j = 0; j < 4; j++)
+        corners[j] = (MisoVec2) {
+            (position.x + tile->offset[j].x - origin.x) * scale * 2.f / chunk->lodRect.w - 1.f,
+            1.f - (position.y + tile->offset[j].y - origin.y) * scale * 2.f / chunk->lodRect.h
         };
+    StoreTile(MISO_VERTEX_DEFAULT, StageImmediate(texture, MISO_TILE_ALPHA_CUTOFF), 0, tile, corners, 0.f);
 }
 
-void MisoDrawTexture(MisoTexture *texture, MisoVec2 position, MisoVec2 size, MisoVec2 scale, MisoVec2 viewportSize, float rotation, MisoRect clip) {
-    Quad quad;
-    GenerateQuad(position, (MisoVec2){texture->w, texture->h}, size, scale, viewportSize, rotation, clip, &quad);
-    sg_buffer_desc desc = {
-        .data = SG_RANGE(quad)
-    };
-    sg_bindings bind = {
-        .vertex_buffers[0] = sg_make_buffer(&desc),
-        .fs_images[SLOT_tex] = texture->sg
+static void BakeImpostor(MisoChunk *chunk) {
+    // Without a depth buffer tiles go in back to front, row by row with
+    // every layer of a row after its ground, which is MisoIsoDepth's order
+    MisoVec2 origin, size;
+    ChunkWorldBounds(chunk, &origin, &size);
+    float scale = chunk->lodScale;
+    sg_apply_viewport(chunk->lodRect.x, chunk->lodRect.y, chunk->lodRect.w, chunk->lodRect.h, true);
+    for (int y = 0; y < chunk->h; y++) {
+        for (int x = 0; x < chunk->w; x++)
+            BakeImpostorTile(chunk, chunk->batch->texture, &chunk->tiles[MisoChunkAt(chunk, x, y)], x, y, origin, scale);
+        for (int i = 0; i < chunk->layerCount; i++) {
+            MisoChunkLayer *layer = &chunk->layers[i];
+            if (!layer->visible || !layer->occupied)
+                continue;
+            for (int x = 0; x < chunk->w; x++) {
+                int value = MisoChunkLayerAt(chunk, i + 1, x, y);
+                if (value >= 0)
+                    BakeImpostorTile(chunk, layer->batch->texture, &layer->tiles[value], x, y, origin, scale);
+            }
+        }
+    }
+    // Every impostor has its own viewport, so its quads can't share a draw with the next one
+    FlushImmediate();
+}
+
+static void ResumeFrame(void) {
+    sg_pass_action action = {
+        .colors[0].action = SG_ACTION_LOAD,
+        .depth.action = SG_ACTION_LOAD,
+        .stencil.action = SG_ACTION_LOAD
     };
-    sg_apply_bindings(&bind);
-    sg_draw(0, 6, 1);
-    sg_destroy_buffer(bind.vertex_buffers[0]);
+#if !defined(MISO_DISABLE_FRAMEBUFFER)
+    sg_begin_pass(state.pass, &action);
+#else
+    sg_begin_default_pass(&action, state.size.x, state.size.y);
+#endif
 }
 
-void MisoDestroyTexture(MisoTexture *texture) {
-    if (texture) {
-        if (sg_query_image_state(texture->sg) == SG_RESOURCESTATE_VALID)
-            sg_destroy_image(texture->sg);
-        free(texture);
+static bool ImpostorValid(MisoChunk *chunk, MisoCamera *camera, bool cached, float scale) {
+    // Zoom changes rebake, panning never does. Only the shared atlas is ever reset
+    MisoTexture *atlas = ImpostorAtlas(chunk, camera, cached);
+    return scale > 0.f && !chunk->lodDirty && chunk->lodAtlas == atlas && chunk->lodScale == scale && (atlas != &state.lodTexture || chunk->lodGeneration == state.lodGeneration);
+}
+
+static int ImpostorTiles(MisoChunk *chunk) {
+    int result = chunk->w * chunk->h;
+    for (int i = 0; i < chunk->layerCount; i++)
+        if (chunk->layers[i].visible)
+            result += chunk->layers[i].occupied;
+    return result;
+}
+
+static bool ImpostorsFit(MisoChunk **chunks, int count, MisoCamera *camera, bool cached) {
+    // Dry run of BakeImpostors on a copy of the shelves, true if every atlas
+    // impostor it would bake this frame still fits
+    int shelfX = state.lodShelfX, shelfY = state.lodShelfY, shelfH = state.lodShelfH;
+    int budget = MISO_LOD_BAKE_TILES;
+    bool fits = true;
+    for (int i = 0; i < count && fits; i++) {
+        MisoChunk *chunk = chunks[i];
+        float scale = ImpostorScale(chunk, camera, cached);
+        if (scale <= 0.f || ImpostorValid(chunk, camera, cached, scale) || ImpostorTiles(chunk) > budget)
+            continue;
+        if (!ImpostorOwnTarget(camera, cached)) {
+            MisoVec2 origin, size;
+            MisoRect rect;
+            ChunkWorldBounds(chunk, &origin, &size);
+            fits = PackImpostor((int)ceilf(size.x * scale), (int)ceilf(size.y * scale), &rect);
+        }
+        budget -= ImpostorTiles(chunk);
     }
+    state.lodShelfX = shelfX;
+    state.lodShelfY = shelfY;
+    state.lodShelfH = shelfH;
+    return fits;
 }
 
-MisoTextureBatch* MisoCreateTextureBatch(MisoTexture *texture, int max) {
-    MisoTextureBatch *result = malloc(sizeof(MisoTextureBatch));
-    result->maxVertices = max * 6;
-    result->vertexCount = 0;
-    result->size = (MisoVec2){texture->w, texture->h};
-    result->vertices = malloc(result->maxVertices * sizeof(MisoVertex));
+static void BakeImpostors(MisoChunk **chunks, int count, MisoCamera *camera, bool cached) {
+    // Chunks too big to ever bake in one frame are always drawn as tiles
+    bool stale = false;
+    for (int i = 0; i < count && !stale; i++) {
+        float scale = ImpostorScale(chunks[i], camera, cached);
+        stale = scale > 0.f && !ImpostorValid(chunks[i], camera, cached, scale) && ImpostorTiles(chunks[i]) <= MISO_LOD_BAKE_TILES;
+    }
+    if (!stale)
+        return;
+    // Edited impostors leave their old slot behind, once the atlas is full it
+    // starts over. That's decided before baking anything, so no chunk is baked
+    // twice. Only once a frame, anything that still doesn't fit is drawn tile
+    // by tile instead
+    bool reset = state.lodResetFrame != state.frame && !ImpostorsFit(chunks, count, camera, cached);
+    if (reset) {
+        state.lodGeneration++;
+        state.lodResetFrame = state.frame;
+        state.lodShelfX = state.lodShelfY = state.lodShelfH = 0;
+    }
+    int budget = MISO_LOD_BAKE_TILES;
+    bool atlasPass = false;
+    // Passes can't nest, so the frame's pass is suspended while baking
+    FlushImmediate();
+    sg_end_pass();
+    for (int i = 0; i < count; i++) {
+        MisoChunk *chunk = chunks[i];
+        float scale = ImpostorScale(chunk, camera, cached);
+        if (scale <= 0.f || ImpostorValid(chunk, camera, cached, scale) || ImpostorTiles(chunk) > budget)
+            continue;
+        MisoVec2 origin, size;
+        ChunkWorldBounds(chunk, &origin, &size);
+        int w = (int)ceilf(size.x * scale), h = (int)ceilf(size.y * scale);
+        sg_pass own = {0};
+        if (ImpostorOwnTarget(camera, cached)) {
+            if (atlasPass)
+                EndImpostorPass();
+            atlasPass = false;
+            own = BeginChunkImpostorPass(chunk, w, h);
+            if (!own.id)
+                continue;
+            chunk->lodRect = (MisoRect){0, 0, w, h};
+        } else {
+            if (!atlasPass)
+                BeginImpostorPass(reset);
+            atlasPass = true;
+            reset = false;
+            if (!PackImpostor(w, h, &chunk->lodRect))
+                continue;
+        }
+        chunk->lodScale = scale;
+        chunk->lodAtlas = ImpostorAtlas(chunk, camera, cached);
+        BakeImpostor(chunk);
+        budget -= ImpostorTiles(chunk);
+        chunk->lodGeneration = state.lodGeneration;
+        chunk->lodDirty = false;
+        if (own.id) {
+            EndImpostorPass();
+            sg_destroy_pass(own);
+        }
+    }
+    if (atlasPass)
+        EndImpostorPass();
+    ResumeFrame();
+}
+
+static int DrawImpostors(MisoChunk **chunks, int count, MisoCamera *camera, bool cached) {
+    // Draws every chunk it has an impostor for as one quad and moves the rest,
+    // in order, to the front of the list for the caller to draw as tiles
+    BakeImpostors(chunks, count, camera, cached);
+    bool flip = !sg_query_features().origin_top_left;
+    int remaining = 0;
+    for (int i = 0; i < count; i++) {
+        MisoChunk *chunk = chunks[i];
+        float scale = ImpostorScale(chunk, camera, cached);
+        // Cached chunks too big for a target of their own, or to bake in a
+        // frame, are drawn as tiles
+        if (cached && (scale <= 0.f || ImpostorTiles(chunk) > MISO_LOD_BAKE_TILES))
+            chunk->cacheFailed = true;
+        if (!ImpostorValid(chunk, camera, cached, scale)) {
+            chunks[remaining++] = chunk;
+            continue;
+        }
+        MisoVec2 origin, size;
+        ChunkWorldBounds(chunk, &origin, &size);
+        // Snapped to whole pixels, so a pan never lands the atlas between texels
+        MisoVec2 screen = TransformPoint(&camera->worldToScreen, origin);
+        float x = roundf(screen.x), y = roundf(screen.y);
+        float w = chunk->lodRect.w / scale * camera->zoom, h = chunk->lodRect.h / scale * camera->zoom;
+        float left = x * 2.f / state.size.x - 1.f, right = (x + w) * 2.f / state.size.x - 1.f;
+        float top = 1.f - y * 2.f / state.size.y, bottom = 1.f - (y + h) * 2.f / state.size.y;
+        MisoVec2 quad[4] = {
+            {left, bottom},
+            {right, bottom},
+            {right, top},
+            {left, top}
+        };
+        Quad *out = StageImmediate(chunk->lodAtlas, MISO_TILE_ALPHA_CUTOFF);
+        // Back row of the chunk, so anything standing on it is drawn over it
+        GenerateQuadVertices(quad, (MisoVec2){chunk->lodAtlas->w, chunk->lodAtlas->h}, chunk->lodRect, MisoIsoDepth(chunk->originY, 0.f), out);
+        if (flip)
+            for (int j = 0; j < 4; j++)
+                (*out)[j].texcoord.y = 1.f - (*out)[j].texcoord.y;
+        chunk->emittedTiles = 0;
+        chunk->culledTiles = chunk->w * chunk->h;
+        chunk->cacheFailed = false;
+    }
+    return remaining;
+}
+
+void MisoSetChunkCached(MisoChunk *chunk, bool enabled) {
+    // Cached chunks are drawn from an impostor baked at the camera's zoom
+    chunk->cached = enabled;
+    chunk->cacheFailed = false;
+    if (!enabled)
+        FreeChunkImpostor(chunk);
+}
+
+void MisoDrawChunk(MisoChunk *chunk, MisoCamera *camera) {
+    int x0, y0, x1, y1, tiles = 0;
+    if ((camera->zoom < MISO_LOD_ZOOM || chunk->cached) && ChunkVisibleRange(chunk, camera, &x0, &y0, &x1, &y1) && !DrawImpostors(&chunk, 1, camera, chunk->cached))
+        return;
+    if (chunk->isStatic) {
+        DrawStaticChunk(chunk, camera);
+        DrawChunkLayers(chunk, camera);
+        return;
+    }
+    MisoTextureBatch *batch = chunk->batch;
+    if (ChunkVisibleRange(chunk, camera, &x0, &y0, &x1, &y1))
+        tiles = (x1 - x0 + 1) * (y1 - y0 + 1);
+    if (batch->flushWhenFull && batch->vertexCount + tiles * 4 > batch->maxVertices)
+        MisoFlushTextureBatch(batch);
+    if (batch->flushWhenFull && tiles * 4 > batch->maxVertices)
+        // Too big for the batch at once, fall back to filling and flushing it tile by tile
+        MisoDrawChunkCustom(chunk, camera, DrawChunkDefault);
+    else {
+        ReserveTextureBatch(batch, batch->vertexCount / 4 + tiles);
+        ChunkMesh mesh;
+        if (ClaimChunkMesh(chunk, camera, batch, &mesh))
+            MeshChunks(&mesh, 1);
+    }
+    MisoFlushTextureBatch(batch);
+    DrawChunkLayers(chunk, camera);
+}
+
+void MisoDestroyChunk(MisoChunk *chunk) {
+    if (chunk) {
+        if (chunk->batch && chunk->ownsBatch)
+            MisoDestroyTextureBatch(chunk->batch);
+        if (chunk->grid)
+            free(chunk->grid);
+        if (chunk->tiles)
+            free(chunk->tiles);
+        for (int i = 0; i < chunk->layerCount; i++) {
+            MisoDestroyTextureBatch(chunk->layers[i].batch);
+            free(chunk->layers[i].tiles);
+            free(chunk->layers[i].occupancy);
+            free(chunk->layers[i].ranks);
+            if (chunk->layers[i].values)
+                free(chunk->layers[i].values);
+        }
+        if (chunk->layers)
+            free(chunk->layers);
+        FreeStaticChunk(chunk);
+        FreeChunkImpostor(chunk);
+        free(chunk->dirtyBands);
+        free(chunk);
+    }
+}
+
+static int FloorDiv(int a, int b) {
+    return a / b - (a % b != 0 && (a < 0) != (b < 0));
+}
+
+// Worlds keep their chunks in square regions, each with a bitmask of which
+// of its chunks are loaded. Finding the chunks in view then costs one lookup
+// per region and skips unloaded space a region or a column at a time
+#define WORLD_REGION_SIZE 8
+
+typedef struct {
+    int x, y;
+    // Column major, the same order chunks are drawn in
+    uint64_t loaded;
+    MisoChunk *chunks[WORLD_REGION_SIZE * WORLD_REGION_SIZE];
+} WorldRegion;
+
+static uint64_t WorldRegionHash(const void *item, uint64_t seed0, uint64_t seed1) {
+    const WorldRegion *region = item;
+    int key[2] = {region->x, region->y};
+    return hashmap_murmur(key, sizeof(key), seed0, seed1);
+}
+
+static int WorldRegionCompare(const void *a, const void *b, void *udata) {
+    (void)udata;
+    const WorldRegion *ra = a;
+    const WorldRegion *rb = b;
+    return ra->x != rb->x ? ra->x - rb->x : ra->y - rb->y;
+}
+
+static WorldRegion* FindWorldRegion(MisoWorld *world, int x, int y) {
+    return hashmap_get(world->regions, &(WorldRegion){.x = x, .y = y});
+}
+
+static void FitWorldRegions(MisoWorld *world) {
+    // Bounds of every region with a loaded chunk, empty when x0 > x1
+    world->regionX0 = world->regionY0 = INT_MAX;
+    world->regionX1 = world->regionY1 = INT_MIN;
+    size_t i = 0;
+    void *item;
+    while (hashmap_iter(world->regions, &i, &item)) {
+        WorldRegion *region = item;
+        world->regionX0 = MIN(world->regionX0, region->x);
+        world->regionY0 = MIN(world->regionY0, region->y);
+        world->regionX1 = MAX(world->regionX1, region->x);
+        world->regionY1 = MAX(world->regionY1, region->y);
+    }
+}
+
+static void SetWorldChunk(MisoWorld *world, int x, int y, MisoChunk *chunk) {
+    int rx = FloorDiv(x, WORLD_REGION_SIZE), ry = FloorDiv(y, WORLD_REGION_SIZE);
+    WorldRegion *region = FindWorldRegion(world, rx, ry);
+    if (!region) {
+        if (!chunk)
+            return;
+        hashmap_set(world->regions, &(WorldRegion){.x = rx, .y = ry});
+        region = FindWorldRegion(world, rx, ry);
+        world->regionX0 = MIN(world->regionX0, rx);
+        world->regionY0 = MIN(world->regionY0, ry);
+        world->regionX1 = MAX(world->regionX1, rx);
+        world->regionY1 = MAX(world->regionY1, ry);
+    }
+    int bit = (x - rx * WORLD_REGION_SIZE) * WORLD_REGION_SIZE + (y - ry * WORLD_REGION_SIZE);
+    region->chunks[bit] = chunk;
+    if (chunk)
+        region->loaded |= 1ULL << bit;
+    else if (!(region->loaded &= ~(1ULL << bit))) {
+        hashmap_delete(world->regions, &(WorldRegion){.x = rx, .y = ry});
+        FitWorldRegions(world);
+    }
+}
+
+static int CollectWorldChunks(MisoWorld *world, int x0, int y0, int x1, int y1, MisoChunk ***result) {
+    // Loaded chunks in the range, x-outer and y-inner like the tiles in a chunk
+    *result = NULL;
+    x0 = MAX(x0, world->regionX0 * WORLD_REGION_SIZE);
+    y0 = MAX(y0, world->regionY0 * WORLD_REGION_SIZE);
+    x1 = MIN(x1, world->regionX1 * WORLD_REGION_SIZE + WORLD_REGION_SIZE - 1);
+    y1 = MIN(y1, world->regionY1 * WORLD_REGION_SIZE + WORLD_REGION_SIZE - 1);
+    if (x0 > x1 || y0 > y1)
+        return 0;
+    int ry0 = FloorDiv(y0, WORLD_REGION_SIZE), ry1 = FloorDiv(y1, WORLD_REGION_SIZE);
+    WorldRegion **column = malloc((ry1 - ry0 + 1) * sizeof(WorldRegion*));
+    MisoChunk **chunks = NULL;
+    int count = 0, capacity = 0;
+    for (int rx = FloorDiv(x0, WORLD_REGION_SIZE); rx <= FloorDiv(x1, WORLD_REGION_SIZE); rx++) {
+        bool any = false;
+        for (int ry = ry0; ry <= ry1; ry++)
+            any |= (column[ry - ry0] = FindWorldRegion(world, rx, ry)) != NULL;
+        if (!any)
+            continue;
+        int left = rx * WORLD_REGION_SIZE;
+        for (int x = MAX(x0, left); x <= MIN(x1, left + WORLD_REGION_SIZE - 1); x++)
+            for (int ry = ry0; ry <= ry1; ry++) {
+                WorldRegion *region = column[ry - ry0];
+                if (!region)
+                    continue;
+                int top = ry * WORLD_REGION_SIZE;
+                int first = MAX(y0 - top, 0), last = MIN(y1 - top, WORLD_REGION_SIZE - 1);
+                uint64_t bits = (region->loaded >> ((x - left) * WORLD_REGION_SIZE)) & ((1ULL << (last + 1)) - 1) & (~0ULL << first);
+                for (; bits; bits &= bits - 1) {
+                    if (count == capacity) {
+                        capacity = MAX(64, capacity * 2);
+                        chunks = realloc(chunks, capacity * sizeof(MisoChunk*));
+                    }
+                    chunks[count++] = region->chunks[(x - left) * WORLD_REGION_SIZE + TrailingZeros64(bits)];
+                }
+            }
+    }
+    free(column);
+    *result = chunks;
+    return count;
+}
+
+MisoWorld* MisoCreateWorld(MisoTexture *texture, int chunkW, int chunkH, int tileW, int tileH) {
+    // Chunk heights must be even so the odd row stagger lines up across chunks
+    assert(!(chunkH % 2));
+    MisoWorld *result = malloc(sizeof(MisoWorld));
+    result->regions = hashmap_new(sizeof(WorldRegion), 0, 0, 0, WorldRegionHash, WorldRegionCompare, NULL, NULL);
+    FitWorldRegions(result);
     result->texture = texture;
-    sg_buffer_desc desc = {
-        .usage = SG_USAGE_STREAM,
-        .size = result->maxVertices * sizeof(MisoVertex)
-    };
-    result->bind = (sg_bindings) {
-        .vertex_buffers[0] = sg_make_buffer(&desc),
-        .fs_images[SLOT_tex] = texture->sg
+    // Every chunk in the world is meshed into one shared batch, so the whole
+    // world is uploaded and drawn at once instead of once per chunk
+    MisoTextureBatchDesc desc = {
+        .texture = texture,
+        .maxQuads = chunkW * chunkH,
+        .format = MISO_VERTEX_COMPACT,
+        .alphaCutoff = MISO_TILE_ALPHA_CUTOFF
     };
+    result->batch = MisoMakeTextureBatch(&desc);
+    result->chunkW = chunkW;
+    result->chunkH = chunkH;
+    result->tileW = tileW;
+    result->tileH = tileH;
+    result->prefetch = 1;
+    result->cached = false;
+    result->load = NULL;
+    result->unload = NULL;
+    result->userdata = NULL;
+    result->poolCount = 0;
     return result;
 }
 
-void MisoResizeTextureBatch(MisoTextureBatch **batch, int newMaxVertices) {
-    MisoTextureBatch *_batch = *batch;
-    assert(batch && _batch->texture && sg_query_image_state(_batch->texture->sg) == SG_RESOURCESTATE_VALID);
-    MisoTextureBatch *new = MisoCreateTextureBatch(_batch->texture, newMaxVertices);
-    MisoDestroyTextureBatch(_batch);
-    *batch = new;
+MisoChunk* MisoWorldChunk(MisoWorld *world, int x, int y) {
+    int rx = FloorDiv(x, WORLD_REGION_SIZE), ry = FloorDiv(y, WORLD_REGION_SIZE);
+    WorldRegion *region = FindWorldRegion(world, rx, ry);
+    return region ? region->chunks[(x - rx * WORLD_REGION_SIZE) * WORLD_REGION_SIZE + (y - ry * WORLD_REGION_SIZE)] : NULL;
 }
 
-void MisoTextureBatchDraw(MisoTextureBatch *batch, MisoVec2 position, MisoVec2 size, MisoVec2 scale, MisoVec2 viewportSize, float rotation, MisoRect clip) {
-    GenerateQuad(position, batch->size, size, scale, viewportSize, rotation, clip, (Quad*)(batch->vertices + batch->vertexCount));
-    batch->vertexCount += 6;
+// Pages a chunk in if it isn't already, MisoUpdateWorld unloads it again
+// once it's out of the camera's range
+MisoChunk* MisoWorldLoadChunk(MisoWorld *world, int x, int y) {
+    MisoChunk *chunk = MisoWorldChunk(world, x, y);
+    if (chunk)
+        return chunk;
+    if (world->poolCount) {
+        chunk = world->pool[--world->poolCount];
+        memset(chunk->grid, 0, chunk->w * chunk->h * chunk->cellSize);
+        for (int i = 1; i <= chunk->layerCount; i++)
+            MisoChunkClearLayer(chunk, i);
+    } else
+        chunk = NewChunk(world->batch, false, world->chunkW, world->chunkH, world->tileW, world->tileH, MISO_CELL_DEFAULT);
+    chunk->originX = x * world->chunkW;
+    chunk->originY = y * world->chunkH;
+    if (world->load)
+        world->load(chunk, x, y, world->userdata);
+    // Recycled chunks have moved, so any static geometry is stale
+    MarkChunkDirty(chunk, 0, 0, chunk->w - 1, chunk->h - 1);
+    SetWorldChunk(world, x, y, chunk);
+    return chunk;
 }
 
-void MisoFlushTextureBatch(MisoTextureBatch *batch) {
-    sg_range range = {
-        .ptr = batch->vertices,
-        .size = batch->vertexCount * sizeof(MisoVertex)
-    };
-    sg_update_buffer(batch->bind.vertex_buffers[0], &range);
-    sg_apply_bindings(&batch->bind);
-    sg_draw(0, batch->vertexCount, 1);
-    memset(batch->vertices, 0, batch->maxVertices * sizeof(MisoVertex));
-    batch->vertexCount = 0;
+static void UnloadWorldChunk(MisoWorld *world, int x, int y) {
+    MisoChunk *chunk = MisoWorldChunk(world, x, y);
+    if (!chunk)
+        return;
+    SetWorldChunk(world, x, y, NULL);
+    if (world->unload)
+        world->unload(chunk, x, y, world->userdata);
+    if (world->poolCount < MISO_WORLD_POOL_SIZE)
+        world->pool[world->poolCount++] = chunk;
+    else
+        MisoDestroyChunk(chunk);
 }
 
-void MisoDestroyTextureBatch(MisoTextureBatch *batch) {
-    if (batch) {
-        if (batch->vertices)
-            free(batch->vertices);
-        if (sg_query_buffer_state(batch->bind.vertex_buffers[0]) == SG_RESOURCESTATE_VALID)
-            sg_destroy_buffer(batch->bind.vertex_buffers[0]);
-        free(batch);
-    }
+int MisoWorldAt(MisoWorld *world, int x, int y) {
+    // Reads never page chunks in, only the camera and MisoWorldLoadChunk decide what's resident
+    int cx = FloorDiv(x, world->chunkW), cy = FloorDiv(y, world->chunkH);
+    MisoChunk *chunk = MisoWorldChunk(world, cx, cy);
+    return chunk ? MisoChunkAt(chunk, x - cx * world->chunkW, y - cy * world->chunkH) : MISO_WORLD_NOT_LOADED;
 }
 
-#define SIGN(A, B, C) (float)((A).x - (C).x) * ((B).y - (C).y) - ((B).x - (C).x) * ((A).y - (C).y)
+void MisoWorldSet(MisoWorld *world, int x, int y, int value) {
+    // Writes have to land somewhere, so the chunk is loaded first
+    int cx = FloorDiv(x, world->chunkW), cy = FloorDiv(y, world->chunkH);
+    MisoChunkSet(MisoWorldLoadChunk(world, cx, cy), x - cx * world->chunkW, y - cy * world->chunkH, value);
+}
 
-static bool IsPointInTri(MisoVec2 pt, MisoVec2 a, MisoVec2 b, MisoVec2 c) {
-    float ab = SIGN(pt, a, b);
-    float bc = SIGN(pt, b, c);
-    float ca = SIGN(pt, c, a);
-    return !(((ab < 0) || (bc < 0) || (ca < 0)) && ((ab > 0) || (bc > 0) || (ca > 0)));
+static void WorldVisibleRange(MisoWorld *world, MisoCamera *camera, int margin, int *x0, int *y0, int *x1, int *y1) {
+    MisoUpdateCamera(camera);
+    MisoVec2 topLeft = TransformPoint(&camera->screenToWorld, (MisoVec2){0.f, 0.f});
+    MisoVec2 bottomRight = TransformPoint(&camera->screenToWorld, state.size);
+    float halfTileH = world->tileH / 2.f;
+    // Pad by a tile for the odd row stagger and the tile extents
+    int tx0 = (int)floorf(topLeft.x / world->tileW) - 1;
+    int tx1 = (int)ceilf(bottomRight.x / world->tileW) + 1;
+    int ty0 = (int)floorf(topLeft.y / halfTileH) - 2;
+    int ty1 = (int)ceilf(bottomRight.y / halfTileH) + 2;
+    *x0 = FloorDiv(tx0, world->chunkW) - margin;
+    *x1 = FloorDiv(tx1, world->chunkW) + margin;
+    *y0 = FloorDiv(ty0, world->chunkH) - margin;
+    *y1 = FloorDiv(ty1, world->chunkH) + margin;
 }
 
-MisoVec2 MisoScreenToChunkTile(MisoChunk *chunk, MisoCamera *camera, MisoVec2 point) {
-    MisoVec2 relativePos = MisoScreenToWorld(camera, point);
-    MisoVec2 gridPosition = {
-        .x = relativePos.x / chunk->tileW,
-        .y = relativePos.y / (chunk->tileH / 2)
-    };
-    MisoVec2 offsetPosition = {
-        .x = gridPosition.x * chunk->tileW,
-        .y = gridPosition.y * chunk->tileH
-    };
-    
-    int halfTileWidth = chunk->tileW / 2;
-    int halfTileHeight = chunk->tileH / 2;
-    MisoVec2 a2 = (MisoVec2){offsetPosition.x + halfTileWidth, offsetPosition.y};
-    MisoVec2 a3 = (MisoVec2){offsetPosition.x, offsetPosition.y+halfTileHeight};
-    MisoVec2 b3 = (MisoVec2){offsetPosition.x+chunk->tileW, offsetPosition.y+halfTileHeight};
-    MisoVec2 c2 = (MisoVec2){offsetPosition.x+halfTileWidth, offsetPosition.y+chunk->tileH};
-    if (IsPointInTri(relativePos, offsetPosition, a2, a3))
-        return (MisoVec2){gridPosition.x-1, gridPosition.y-1};
-    if (IsPointInTri(relativePos, a2, (MisoVec2){offsetPosition.x+chunk->tileW, offsetPosition.y}, (MisoVec2){offsetPosition.x+chunk->tileW, offsetPosition.y+halfTileHeight}))
-        return (MisoVec2){gridPosition.x, gridPosition.y-1};
-    if (IsPointInTri(relativePos, a3, (MisoVec2){offsetPosition.x+halfTileWidth, offsetPosition.y+chunk->tileH}, (MisoVec2){offsetPosition.x, offsetPosition.y+chunk->tileH}))
-        return (MisoVec2){gridPosition.x-1, gridPosition.y+1};
-    if (IsPointInTri(relativePos, c2, b3, (MisoVec2){offsetPosition.x+chunk->tileW, offsetPosition.y+chunk->tileH}))
-        return (MisoVec2){gridPosition.x, gridPosition.y++};
-    return gridPosition;
+void MisoUpdateWorld(MisoWorld *world, MisoCamera *camera) {
+    int x0, y0, x1, y1;
+    WorldVisibleRange(world, camera, world->prefetch, &x0, &y0, &x1, &y1);
+    size_t count = hashmap_count(world->regions) * WORLD_REGION_SIZE * WORLD_REGION_SIZE;
+    if (count) {
+        // Can't delete while iterating, collect anything out of range first
+        int (*evict)[2] = malloc(count * sizeof(int[2]));
+        int evictCount = 0;
+        size_t i = 0;
+        void *item;
+        while (hashmap_iter(world->regions, &i, &item)) {
+            WorldRegion *region = item;
+            for (uint64_t bits = region->loaded; bits; bits &= bits - 1) {
+                int bit = TrailingZeros64(bits);
+                int x = region->x * WORLD_REGION_SIZE + bit / WORLD_REGION_SIZE;
+                int y = region->y * WORLD_REGION_SIZE + bit % WORLD_REGION_SIZE;
+                if (x < x0 || x > x1 || y < y0 || y > y1) {
+                    evict[evictCount][0] = x;
+                    evict[evictCount++][1] = y;
+                }
+            }
+        }
+        for (int j = 0; j < evictCount; j++)
+            UnloadWorldChunk(world, evict[j][0], evict[j][1]);
+        free(evict);
+    }
+    for (int x = x0; x <= x1; x++)
+        for (int y = y0; y <= y1; y++)
+            MisoWorldLoadChunk(world, x, y);
 }
 
-MisoVec2 MisoChunkTileToScreen(MisoChunk *chunk, MisoCamera *camera, MisoVec2 point) {
-    MisoVec2 halfTileSize = {chunk->tileW / 2.f, chunk->tileH / 2.f};
-    int x = (int)point.x;
-    int y = (int)point.y;
-    MisoVec2 offset = {
-        .x = halfTileSize.x + (-camera->position.x + state.size.x / 2),
-        .y = halfTileSize.y + (-camera->position.y + state.size.y / 2)
+void MisoDrawWorld(MisoWorld *world, MisoCamera *camera) {
+    int x0, y0, x1, y1;
+    WorldVisibleRange(world, camera, 0, &x0, &y0, &x1, &y1);
+    MisoChunk **chunks;
+    int count = CollectWorldChunks(world, x0, y0, x1, y1, &chunks);
+    if (camera->zoom < MISO_LOD_ZOOM || world->cached)
+        count = DrawImpostors(chunks, count, camera, world->cached);
+    int tiles = 0;
+    for (int i = 0; i < count; i++) {
+        int tx0, ty0, tx1, ty1;
+        if (!chunks[i]->isStatic && ChunkVisibleRange(chunks[i], camera, &tx0, &ty0, &tx1, &ty1))
+            tiles += (tx1 - tx0 + 1) * (ty1 - ty0 + 1);
+    }
+    ReserveTextureBatch(world->batch, world->batch->vertexCount / 4 + tiles);
+    // Every visible dynamic chunk claims its range of the world batch up front,
+    // then all of them are meshed in one parallel pass
+    ChunkMesh *meshes = malloc(MAX(1, count) * sizeof(ChunkMesh));
+    int meshCount = 0;
+    for (int i = 0; i < count; i++) {
+        if (chunks[i]->isStatic)
+            DrawStaticChunk(chunks[i], camera);
+        else if (ClaimChunkMesh(chunks[i], camera, world->batch, &meshes[meshCount]))
+            meshCount++;
+    }
+    MeshChunks(meshes, meshCount);
+    free(meshes);
+    MisoFlushTextureBatch(world->batch);
+    for (int i = 0; i < count; i++)
+        DrawChunkLayers(chunks[i], camera);
+    if (chunks)
+        free(chunks);
+}
+
+void MisoDestroyWorld(MisoWorld *world) {
+    if (world) {
+        if (world->regions) {
+            size_t i = 0;
+            void *item;
+            while (hashmap_iter(world->regions, &i, &item)) {
+                WorldRegion *region = item;
+                for (uint64_t bits = region->loaded; bits; bits &= bits - 1) {
+                    int bit = TrailingZeros64(bits);
+                    if (world->unload)
+                        world->unload(region->chunks[bit], region->x * WORLD_REGION_SIZE + bit / WORLD_REGION_SIZE, region->y * WORLD_REGION_SIZE + bit % WORLD_REGION_SIZE, world->userdata);
+                    MisoDestroyChunk(region->chunks[bit]);
+                }
+            }
+            hashmap_free(world->regions);
+        }
+        for (int i = 0; i < world->poolCount; i++)
+            MisoDestroyChunk(world->pool[i]);
+        MisoDestroyTextureBatch(world->batch);
+        free(world);
+    }
+}
+
+typedef struct {
+    // Screen pixels -> tile units, u = x * scaleU + offsetU
+    float scaleU, scaleV, offsetU, offsetV;
+    int originX, originY;
+} TilePicker;
+
+static TilePicker ChunkTilePicker(MisoChunk *chunk, MisoCamera *camera) {
+    // The camera's screen -> world transform, scaled so a tile's bounding box
+    // is one unit wide and one unit tall
+    MisoUpdateCamera(camera);
+    const MisoTransform *view = &camera->screenToWorld;
+    return (TilePicker) {
+        .scaleU = view->x[0] / chunk->tileW,
+        .scaleV = view->y[1] / chunk->tileH,
+        .offsetU = view->x[2] / chunk->tileW,
+        .offsetV = view->y[2] / chunk->tileH,
+        .originX = chunk->originX,
+        .originY = chunk->originY
     };
+}
+
+static MisoVec2 PickTile(const TilePicker *picker, MisoVec2 point) {
+    float u = point.x * picker->scaleU + picker->offsetU;
+    float v = point.y * picker->scaleV + picker->offsetV;
+    // Rotated 45 degrees every diamond becomes a unit square centred on an
+    // integer (s, t), with s - t = y + 1 and s + t = 2x + 1 on even rows or
+    // 2x + 2 on odd rows
+    int s = (int)floorf(u + v + .5f);
+    int t = (int)floorf(u - v + .5f);
+    int n = s + t - 1;
     return (MisoVec2) {
-        offset.x + ((float)x * chunk->tileW) + (y % 2 ? halfTileSize.x : 0),
-        offset.y + ((float)y * chunk->tileH) - (y * halfTileSize.y)
+        (float)((n - (n & 1)) / 2 - picker->originX),
+        (float)(s - t - 1 - picker->originY)
     };
 }
 
+MisoVec2 MisoScreenToChunkTile(MisoChunk *chunk, MisoCamera *camera, MisoVec2 point) {
+    TilePicker picker = ChunkTilePicker(chunk, camera);
+    return PickTile(&picker, point);
+}
+
+void MisoScreenToChunkTiles(MisoChunk *chunk, MisoCamera *camera, const MisoVec2 *points, MisoVec2 *tiles, int count) {
+    TilePicker picker = ChunkTilePicker(chunk, camera);
+    for (int i = 0; i < count; i++)
+        tiles[i] = PickTile(&picker, points[i]);
+}
+
+MisoVec2 MisoChunkTileToScreen(MisoChunk *chunk, MisoCamera *camera, MisoVec2 point) {
+    MisoUpdateCamera(camera);
+    return ChunkTileToScreen(chunk, camera, (int)point.x, (int)point.y);
+}
+
 MisoVec2 MisoScreenToWorld(MisoCamera *camera, MisoVec2 point) {
-    return (MisoVec2){
-        .x = (camera->position.x - (state.size.x / 2)) + point.x,
-        .y = (camera->position.y - (state.size.y / 2)) + point.y
-    };
+    MisoUpdateCamera(camera);
+    return TransformPoint(&camera->screenToWorld, point);
 }
 
 MisoVec2 MisoWorldToScreen(MisoCamera *camera, MisoVec2 point) {
-    // TODO: Implement World to Screen coordinates
-    return (MisoVec2){0, 0};
+    MisoUpdateCamera(camera);
+    return TransformPoint(&camera->worldToScreen, point);
+}
+
+void MisoUpdateCamera(MisoCamera *camera) {
+    if (camera->viewZoom == camera->zoom &&
+        camera->viewPosition.x == camera->position.x && camera->viewPosition.y == camera->position.y &&
+        camera->viewSize.x == state.size.x && camera->viewSize.y == state.size.y)
+        return;
+    float zoom = camera->zoom;
+    MisoVec2 position = camera->position;
+    MisoVec2 centre = {state.size.x / 2.f, state.size.y / 2.f};
+    // Zoom scales around the centre of the viewport, which is where the camera sits
+    camera->worldToScreen = (MisoTransform) {
+        .x = {zoom, 0.f, centre.x - position.x * zoom},
+        .y = {0.f, zoom, centre.y - position.y * zoom}
+    };
+    camera->screenToWorld = (MisoTransform) {
+        .x = {1.f / zoom, 0.f, position.x - centre.x / zoom},
+        .y = {0.f, 1.f / zoom, position.y - centre.y / zoom}
+    };
+    // worldToScreen followed by ViewportTransform, folded by hand so the
+    // camera position cancels out of the offset exactly
+    float sx =  2.f * zoom / state.size.x;
+    float sy = -2.f * zoom / state.size.y;
+    camera->worldToClip = (MisoTransform) {
+        .x = {sx, 0.f, -sx * position.x},
+        .y = {0.f, sy, -sy * position.y}
+    };
+    camera->viewPosition = position;
+    camera->viewZoom = zoom;
+    camera->viewSize = state.size;
 }
 
 #if !defined(MISO_DISABLE_FRAMEBUFFER)
@@ -1825,32 +5724,30 @@ static void DestroyFramebuffer(void) {
 static void BuildFramebuffer(int width, int height) {
     DestroyFramebuffer();
     state.size = (MisoVec2){width, height};
-    
-    sg_image_desc img_desc = {
-        .render_target = true,
-        .width = width,
-        .height = height,
-        .pixel_format = SG_PIXELFORMAT_RGBA8,
-        .min_filter = SG_FILTER_NEAREST,
-        .mag_filter = SG_FILTER_NEAREST,
-        .wrap_u = SG_WRAP_REPEAT,
-        .wrap_v = SG_WRAP_REPEAT
-    };
-    state.color = sg_make_image(&img_desc);
-    img_desc.pixel_format = SG_PIXELFORMAT_DEPTH;
-    state.depth = sg_make_image(&img_desc);
-    sg_pass_desc pass_desc = {
-        .color_attachments[0].image = state.color,
-        .depth_stencil_attachment.image = state.depth
-    };
-    state.pass = sg_make_pass(&pass_desc);
+    state.pass = MakeRenderTarget(width, height, &state.color, &state.depth);
     state.bind.fs_images[0] = state.color;
 }
 
+static void MakeTexturePipelines(MisoVertexFormat format, sg_pipeline_desc *desc) {
+    // Batches pick 16 or 32 bit indices depending on their size, and
+    // whether they're cut out or blended without writing depth
+    for (int i = 0; i < 2; i++) {
+        desc->index_type = i ? SG_INDEXTYPE_UINT32 : SG_INDEXTYPE_UINT16;
+        for (int j = 0; j < 2; j++) {
+            desc->depth.write_enabled = j;
+            state.offscreen_pip[format][i][j] = sg_make_pipeline(desc);
+        }
+    }
+    desc->depth.write_enabled = true;
+}
+
 void OrderMiso(void) {
     assert(!state.initialized);
     state.initialized = true;
     state.size = (MisoVec2){-1, -1};
+#if !defined(MISO_DISABLE_JOBS)
+    StartJobs();
+#endif
     
 #if !defined(MISO_DISABLE_FRAMEBUFFER)
     const float vertices[] = {
@@ -1895,6 +5792,31 @@ void OrderMiso(void) {
     state.framebuffer_pip = sg_make_pipeline(&framebuffer_desc);
 #endif
     
+    const uint16_t quad_indices[] = {
+        0, 1, 2,
+        3, 0, 2
+    };
+    sg_buffer_desc quad_indices_desc = {
+        .type = SG_BUFFERTYPE_INDEXBUFFER,
+        .data = SG_RANGE(quad_indices)
+    };
+    state.quad_indices = sg_make_buffer(&quad_indices_desc);
+    const float quad_corners[] = {
+        0.f, 1.f, // bottom left
+        1.f, 1.f, // bottom right
+        1.f, 0.f, // top right
+        0.f, 0.f  // top left
+    };
+    sg_buffer_desc quad_corners_desc = {
+        .data = SG_RANGE(quad_corners)
+    };
+    state.quad_corners = sg_make_buffer(&quad_corners_desc);
+    sg_index_type transientIndexType;
+    state.transientIndices = MakeQuadIndices(MISO_TRANSIENT_QUADS, &transientIndexType);
+    assert(transientIndexType == SG_INDEXTYPE_UINT16);
+    state.immediate = malloc(MISO_TRANSIENT_QUADS * sizeof(Quad));
+    state.immediateRuns = malloc(MISO_TRANSIENT_QUADS * sizeof(MisoRenderRun));
+    
     sg_pipeline_desc offscreen_desc = {
         .primitive_type = SG_PRIMITIVETYPE_TRIANGLES,
         .shader = sg_make_shader(texture_program_shader_desc(sg_query_backend())),
@@ -1903,11 +5825,12 @@ void OrderMiso(void) {
             .attrs = {
                 [ATTR_texture_vs_position].format=SG_VERTEXFORMAT_FLOAT2,
                 [ATTR_texture_vs_texcoord].format=SG_VERTEXFORMAT_FLOAT2,
-                [ATTR_texture_vs_color].format=SG_VERTEXFORMAT_FLOAT4
+                [ATTR_texture_vs_color].format=SG_VERTEXFORMAT_FLOAT4,
+                [ATTR_texture_vs_depth].format=SG_VERTEXFORMAT_FLOAT
             }
         },
         .depth = {
-            .pixel_format = SG_PIXELFORMAT_DEPTH,
+            .pixel_format = SG_PIXELFORMAT_DEPTH_STENCIL,
             .compare = SG_COMPAREFUNC_LESS_EQUAL,
             .write_enabled = true,
         },
@@ -1924,7 +5847,78 @@ void OrderMiso(void) {
             .pixel_format = SG_PIXELFORMAT_RGBA8
         }
     };
-    state.offscreen_pip = sg_make_pipeline(&offscreen_desc);
+    MakeTexturePipelines(MISO_VERTEX_DEFAULT, &offscreen_desc);
+    // Impostors are baked back to front into an atlas with no depth buffer
+    sg_pipeline_desc lod_desc = offscreen_desc;
+    lod_desc.index_type = SG_INDEXTYPE_UINT16;
+    lod_desc.depth = (sg_depth_state) {
+        .pixel_format = SG_PIXELFORMAT_NONE
+    };
+    state.lodPipeline = sg_make_pipeline(&lod_desc);
+    state.lodGeneration = 1;
+    state.lodResetFrame = 0;
+    state.lodShelfX = state.lodShelfY = state.lodShelfH = 0;
+    // Compact vertices are unpacked by the input assembler, the shader is shared
+    offscreen_desc.layout.buffers[0].stride = sizeof(MisoCompactVertex);
+    offscreen_desc.layout.attrs[ATTR_texture_vs_texcoord].format = SG_VERTEXFORMAT_USHORT2N;
+    offscreen_desc.layout.attrs[ATTR_texture_vs_color].format = SG_VERTEXFORMAT_UBYTE4N;
+    MakeTexturePipelines(MISO_VERTEX_COMPACT, &offscreen_desc);
+    // Multi texture batches carry the sampler slot per vertex
+    offscreen_desc.shader = sg_make_shader(multi_program_shader_desc(sg_query_backend()));
+    offscreen_desc.layout = (sg_layout_desc) {
+        .buffers[0].stride = sizeof(MisoMultiVertex),
+        .attrs = {
+            [ATTR_multi_vs_position].format = SG_VERTEXFORMAT_FLOAT2,
+            [ATTR_multi_vs_texcoord].format = SG_VERTEXFORMAT_FLOAT2,
+            [ATTR_multi_vs_color].format = SG_VERTEXFORMAT_UBYTE4N,
+            [ATTR_multi_vs_slot].format = SG_VERTEXFORMAT_FLOAT,
+            [ATTR_multi_vs_depth].format = SG_VERTEXFORMAT_FLOAT
+        }
+    };
+    MakeTexturePipelines(MISO_VERTEX_MULTI, &offscreen_desc);
+    // Instanced sprites step through one record per instance and always use the shared quad indices
+    offscreen_desc.shader = sg_make_shader(sprite_program_shader_desc(sg_query_backend()));
+    offscreen_desc.layout = (sg_layout_desc) {
+        .buffers = {
+            [0].stride = 2 * sizeof(float),
+            [1] = {
+                .stride = sizeof(MisoSpriteInstance),
+                .step_func = SG_VERTEXSTEP_PER_INSTANCE
+            }
+        },
+        .attrs = {
+            [ATTR_sprite_vs_corner] = {
+                .buffer_index = 0,
+                .format = SG_VERTEXFORMAT_FLOAT2
+            },
+            [ATTR_sprite_vs_rect] = {
+                .buffer_index = 1,
+                .offset = offsetof(MisoSpriteInstance, position),
+                .format = SG_VERTEXFORMAT_FLOAT4
+            },
+            [ATTR_sprite_vs_clip] = {
+                .buffer_index = 1,
+                .offset = offsetof(MisoSpriteInstance, clip),
+                .format = SG_VERTEXFORMAT_USHORT4N
+            },
+            [ATTR_sprite_vs_color] = {
+                .buffer_index = 1,
+                .offset = offsetof(MisoSpriteInstance, color),
+                .format = SG_VERTEXFORMAT_UBYTE4N
+            },
+            [ATTR_sprite_vs_rotation] = {
+                .buffer_index = 1,
+                .offset = offsetof(MisoSpriteInstance, rotation),
+                .format = SG_VERTEXFORMAT_FLOAT
+            },
+            [ATTR_sprite_vs_depth] = {
+                .buffer_index = 1,
+                .offset = offsetof(MisoSpriteInstance, depth),
+                .format = SG_VERTEXFORMAT_FLOAT
+            }
+        }
+    };
+    MakeTexturePipelines(MISO_VERTEX_INSTANCED, &offscreen_desc);
 }
 
 void OrderUp(unsigned int width, unsigned int height) {
@@ -1934,16 +5928,18 @@ void OrderUp(unsigned int width, unsigned int height) {
 #endif
     assert(!state.inProgress);
     state.inProgress = true;
+    state.frame++;
+    state.transientIndex = 0;
 #if !defined(MISO_DISABLE_FRAMEBUFFER)
     sg_begin_pass(state.pass, &state.pass_action);
 #else
     sg_begin_default_pass(&state.pass_action, state.size.x, state.size.y);
 #endif
-    sg_apply_pipeline(state.offscreen_pip);
 }
 
 void FinishMiso(void) {
     assert(state.inProgress);
+    FlushImmediate();
     state.inProgress = false;
     sg_end_pass();
 #if !defined(MISO_DISABLE_FRAMEBUFFER)
@@ -1958,10 +5954,33 @@ void FinishMiso(void) {
 void CleanUpMiso(void) {
     assert(state.initialized);
     state.initialized = false;
+#if !defined(MISO_DISABLE_JOBS)
+    StopJobs();
+#endif
 #if !defined(MISO_DISABLE_FRAMEBUFFER)
     DestroyFramebuffer();
     sg_destroy_pipeline(state.framebuffer_pip);
     sg_destroy_buffer(state.bind.vertex_buffers[0]);
 #endif
-    sg_destroy_pipeline(state.offscreen_pip);
+    for (int i = 0; i < MISO_VERTEX_FORMAT_COUNT; i++)
+        for (int j = 0; j < 2; j++) {
+            sg_destroy_pipeline(state.offscreen_pip[i][j][0]);
+            sg_destroy_pipeline(state.offscreen_pip[i][j][1]);
+        }
+    sg_destroy_pipeline(state.lodPipeline);
+    if (sg_query_pass_state(state.lodPass) == SG_RESOURCESTATE_VALID)
+        sg_destroy_pass(state.lodPass);
+    if (sg_query_image_state(state.lodTexture.sg) == SG_RESOURCESTATE_VALID)
+        sg_destroy_image(state.lodTexture.sg);
+    sg_destroy_buffer(state.quad_indices);
+    sg_destroy_buffer(state.quad_corners);
+    sg_destroy_buffer(state.transientIndices);
+    for (int i = 0; i < state.transientCount; i++)
+        sg_destroy_buffer(state.transient[i]);
+    if (state.transient)
+        free(state.transient);
+    state.transient = NULL;
+    state.transientCount = 0;
+    free(state.immediate);
+    free(state.immediateRuns);
 }
@@ -27,6 +27,7 @@ typedef enum bool { false = 0, true = !false } bool;
 #include <time.h>
 #include <stdlib.h>
 #include <float.h>
+#include <limits.h>
 #include <math.h>
 #include <string.h>
 #include <stdarg.h>
@@ -88,40 +89,261 @@ typedef struct {
 typedef struct {
     MisoVec2 position, texcoord;
     MisoVec4 color;
+    float depth;
 } MisoVertex;
 
+typedef struct {
+    MisoVec2 position;
+    unsigned short texcoord[2];
+    MisoColor color;
+    float depth;
+} MisoCompactVertex;
+
+typedef struct {
+    MisoVec2 position, size;
+    MisoRect clip;
+    float rotation, depth;
+} MisoSprite;
+
+typedef struct {
+    MisoVec2 position, size;
+    unsigned short clip[4];
+    MisoColor color;
+    float rotation, depth;
+} MisoSpriteInstance;
+
+typedef struct {
+    MisoVec2 position, texcoord;
+    MisoColor color;
+    float slot, depth;
+} MisoMultiVertex;
+
+typedef enum {
+    MISO_VERTEX_DEFAULT = 0,
+    MISO_VERTEX_COMPACT,
+    MISO_VERTEX_INSTANCED,
+    MISO_VERTEX_MULTI,
+    MISO_VERTEX_FORMAT_COUNT
+} MisoVertexFormat;
+
 typedef struct {
     sg_image sg;
     int w, h;
 } MisoTexture;
 
+typedef struct {
+    int x, y, w;
+} MisoAtlasNode;
+
+typedef struct {
+    MisoImage *image;
+    MisoTexture *texture;
+    MisoAtlasNode *skyline;
+    int nodeCount, padding;
+    bool dirty;
+} MisoAtlas;
+
+// Number of sampler slots in multi_fs
+#define MISO_MAX_BATCH_TEXTURES 4
+
 typedef struct {
     MisoTexture *texture;
-    MisoVertex *vertices;
+    MisoTexture *textures[MISO_MAX_BATCH_TEXTURES];
+    int textureCount;
+    MisoVertexFormat format;
+    void *vertices;
     int maxVertices, vertexCount;
+    bool flushWhenFull;
+    float alphaCutoff;
     sg_bindings bind;
+    sg_index_type indexType;
+    sg_buffer *spillBuffers;
+    int spillCount, flushCount;
+    unsigned int flushFrame;
     MisoVec2 size;
 } MisoTextureBatch;
 
 typedef struct {
+    MisoTexture *texture;
+    MisoTexture *textures[MISO_MAX_BATCH_TEXTURES];
+    int maxQuads;
+    MisoVertexFormat format;
+    bool flushWhenFull;
+    // Texels with less alpha are discarded and the rest write depth. 0 blends
+    // every texel without writing depth, so those batches go back to front
+    float alphaCutoff;
+} MisoTextureBatchDesc;
+
+typedef struct {
+    uint64_t key;
+    int item;
+} MisoRenderKey;
+
+typedef struct {
+    MisoTexture *texture;
+    MisoSprite sprite;
+} MisoRenderItem;
+
+typedef struct {
+    MisoTexture *texture;
+    int first, count;
+} MisoRenderRun;
+
+// Sprites are drawn sorted by layer, then back to front by depth. Layer
+// wins, the queue blends without writing depth so depth only orders sprites
+// within a layer and against the tiles already drawn
+typedef struct {
+    MisoRenderItem *items;
+    MisoRenderKey *keys, *scratch;
+    MisoSprite *sprites;
+    MisoRenderRun *runs;
+    int count, capacity;
+    MisoVertexFormat format;
     MisoTextureBatch *batch;
-    int *grid;
+} MisoRenderQueue;
+
+typedef struct {
+    MisoRect clip;
+    MisoVec2 offset[4], texcoord[4];
+    unsigned short packed[4][2];
+} MisoTileTemplate;
+
+typedef struct {
+    MisoTextureBatch *batch;
+    MisoTileTemplate *tiles;
+    int tileCount;
+    uint64_t *occupancy;
+    int *ranks;
+    int *values;
+    int occupied, capacity;
+    bool visible;
+} MisoChunkLayer;
+
+typedef enum {
+    // Narrowest width that fits every tile in the tileset
+    MISO_CELL_DEFAULT = 0,
+    MISO_CELL_8,
+    MISO_CELL_16,
+    MISO_CELL_32
+} MisoCellFormat;
+
+typedef struct {
+    MisoTextureBatch *batch;
+    bool ownsBatch;
+    void *grid;
+    int cellSize;
+    MisoTileTemplate *tiles;
+    int tileCount;
+    MisoChunkLayer *layers;
+    int layerCount;
     float tileW, tileH;
     int w, h;
+    int originX, originY;
+    int emittedTiles, culledTiles;
+    bool isStatic;
+    uint64_t *dirtyBands;
+    int dirtyBandCount;
+    void *staticVertices;
+    sg_buffer *staticBands;
+    int staticBandCount;
+    sg_buffer staticIndices;
+    sg_index_type staticIndexType;
+    unsigned int updatedFrame;
+    bool cached;
+    MisoRect lodRect;
+    float lodScale;
+    unsigned int lodGeneration;
+    bool lodDirty;
+    // Cached chunks are baked into a target of their own, zoomed out ones share an atlas
+    MisoTexture lodTarget, *lodAtlas;
+    // Set when a cached chunk couldn't be baked and was drawn as tiles
+    bool cacheFailed;
 } MisoChunk;
 
+typedef struct {
+    MisoTexture *texture;
+    int w, h;
+    int tileW, tileH;
+    MisoCellFormat cellFormat;
+} MisoChunkDesc;
+
+typedef struct {
+    // Rows of a 2x3 affine transform, x' = x[0] * x + x[1] * y + x[2]
+    float x[3], y[3];
+} MisoTransform;
+
 typedef struct {
     MisoVec2 position;
     float zoom;
+    // Cached from the position, zoom and viewport size they were built for,
+    // MisoUpdateCamera rebuilds them once any of those change and the draw
+    // and conversion functions call it first
+    MisoVec2 viewPosition, viewSize;
+    float viewZoom;
+    MisoTransform worldToScreen, screenToWorld, worldToClip;
 } MisoCamera;
 
+#if !defined(MISO_DEPTH_ROWS)
+#define MISO_DEPTH_ROWS 65536
+#endif
+#if !defined(MISO_DEPTH_LAYERS)
+#define MISO_DEPTH_LAYERS 16
+#endif
+// Alpha cutoff of chunk and world batches, tiles overlap and are drawn in
+// any order so they rely on the depth test
+#if !defined(MISO_TILE_ALPHA_CUTOFF)
+#define MISO_TILE_ALPHA_CUTOFF .5f
+#endif
+
+#if !defined(MISO_WORLD_POOL_SIZE)
+#define MISO_WORLD_POOL_SIZE 8
+#endif
+// MisoWorldAt's result for a tile whose chunk isn't loaded
+#define MISO_WORLD_NOT_LOADED -1
+
+typedef struct {
+    struct hashmap *regions;
+    int regionX0, regionY0, regionX1, regionY1;
+    MisoTexture *texture;
+    MisoTextureBatch *batch;
+    int chunkW, chunkH;
+    int tileW, tileH;
+    int prefetch;
+    bool cached;
+    void(*load)(MisoChunk *chunk, int x, int y, void *userdata);
+    void(*unload)(MisoChunk *chunk, int x, int y, void *userdata);
+    void *userdata;
+    MisoChunk *pool[MISO_WORLD_POOL_SIZE];
+    int poolCount;
+} MisoWorld;
+
+EXPORT void MisoParallelFor(int count, void(*func)(void *userdata, int index), void *userdata);
+
+EXPORT MisoChunk* MisoMakeChunk(MisoChunkDesc *desc);
 EXPORT MisoChunk* MisoEmptyChunk(MisoTexture *texture, int w, int h, int tw, int th);
 EXPORT int MisoChunkAt(MisoChunk *chunk, int x, int y);
 EXPORT void MisoChunkSet(MisoChunk *chunk, int x, int y, int value);
+EXPORT int MisoChunkAddLayer(MisoChunk *chunk, MisoTexture *texture);
+EXPORT int MisoChunkLayerAt(MisoChunk *chunk, int layer, int x, int y);
+EXPORT void MisoChunkLayerSet(MisoChunk *chunk, int layer, int x, int y, int value);
+EXPORT void MisoChunkClearLayer(MisoChunk *chunk, int layer);
+EXPORT void MisoChunkSetLayerVisible(MisoChunk *chunk, int layer, bool visible);
 EXPORT void MisoDrawChunkCustom(MisoChunk *chunk, MisoCamera *camera, void(*cb)(MisoChunk*, MisoCamera*, MisoVec2, MisoVec2));
+EXPORT void MisoSetChunkStatic(MisoChunk *chunk, bool enabled);
+EXPORT void MisoSetChunkCached(MisoChunk *chunk, bool enabled);
+EXPORT void MisoUpdateChunk(MisoChunk *chunk);
 EXPORT void MisoDrawChunk(MisoChunk *chunk, MisoCamera *camera);
 EXPORT void MisoDestroyChunk(MisoChunk *chunk);
 
+EXPORT MisoWorld* MisoCreateWorld(MisoTexture *texture, int chunkW, int chunkH, int tileW, int tileH);
+EXPORT MisoChunk* MisoWorldChunk(MisoWorld *world, int x, int y);
+EXPORT MisoChunk* MisoWorldLoadChunk(MisoWorld *world, int x, int y);
+EXPORT int MisoWorldAt(MisoWorld *world, int x, int y);
+EXPORT void MisoWorldSet(MisoWorld *world, int x, int y, int value);
+EXPORT void MisoUpdateWorld(MisoWorld *world, MisoCamera *camera);
+EXPORT void MisoDrawWorld(MisoWorld *world, MisoCamera *camera);
+EXPORT void MisoDestroyWorld(MisoWorld *world);
+
 EXPORT MisoImage* MisoEmptyImage(unsigned int w, unsigned int h);
 EXPORT void MisoDestroyImage(MisoImage *img);
 EXPORT void MisoImagePSet(MisoImage *img, int x, int y, MisoColor col);
@@ -133,19 +355,35 @@ EXPORT MisoTexture* MisoLoadTextureFromImage(MisoImage *img);
 EXPORT MisoTexture* MisoLoadTextureFromFile(const char *path);
 EXPORT MisoTexture* MisoEmptyTexture(int w, int h);
 EXPORT void MisoUpdateTexture(MisoTexture *texture, MisoImage *img);
+EXPORT float MisoIsoDepth(float row, float height);
 EXPORT void MisoDrawTexture(MisoTexture *texture, MisoVec2 position, MisoVec2 size, MisoVec2 scale, MisoVec2 viewportSize, float rotation, MisoRect clip);
+EXPORT void MisoFlush(void);
 EXPORT void MisoDestroyTexture(MisoTexture *texture);
 
-EXPORT MisoTextureBatch* MisoCreateTextureBatch(MisoTexture *texture, int maxVertices);
-EXPORT void MisoResizeTextureBatch(MisoTextureBatch **batch, int newMaxVertices);
+EXPORT MisoAtlas* MisoCreateAtlas(int w, int h, int padding);
+EXPORT bool MisoAtlasPack(MisoAtlas *atlas, MisoImage *img, MisoRect *rect);
+EXPORT MisoTexture* MisoAtlasTexture(MisoAtlas *atlas);
+EXPORT void MisoDestroyAtlas(MisoAtlas *atlas);
+EXPORT MisoTextureBatch* MisoMakeTextureBatch(MisoTextureBatchDesc *desc);
+EXPORT MisoTextureBatch* MisoCreateTextureBatch(MisoTexture *texture, int maxQuads);
+EXPORT void MisoResizeTextureBatch(MisoTextureBatch **batch, int newMaxQuads);
 EXPORT void MisoTextureBatchDraw(MisoTextureBatch *batch, MisoVec2 position, MisoVec2 size, MisoVec2 scale, MisoVec2 viewportSize, float rotation, MisoRect clip);
+EXPORT void MisoTextureBatchDrawTexture(MisoTextureBatch *batch, MisoTexture *texture, MisoVec2 position, MisoVec2 size, MisoVec2 scale, MisoVec2 viewportSize, float rotation, MisoRect clip);
+EXPORT void MisoTextureBatchDrawSprites(MisoTextureBatch *batch, const MisoSprite *sprites, int count, MisoVec2 scale, MisoVec2 viewportSize);
 EXPORT void MisoFlushTextureBatch(MisoTextureBatch *batch);
 EXPORT void MisoDestroyTextureBatch(MisoTextureBatch *batch);
 
+EXPORT MisoRenderQueue* MisoCreateRenderQueue(int maxItems, MisoVertexFormat format);
+EXPORT void MisoRenderQueuePush(MisoRenderQueue *queue, MisoTexture *texture, const MisoSprite *sprite, unsigned char layer);
+EXPORT void MisoFlushRenderQueue(MisoRenderQueue *queue, MisoVec2 scale, MisoVec2 viewportSize);
+EXPORT void MisoDestroyRenderQueue(MisoRenderQueue *queue);
+
 EXPORT MisoVec2 MisoScreenToChunkTile(MisoChunk *chunk, MisoCamera *camera, MisoVec2 point);
+EXPORT void MisoScreenToChunkTiles(MisoChunk *chunk, MisoCamera *camera, const MisoVec2 *points, MisoVec2 *tiles, int count);
 EXPORT MisoVec2 MisoChunkTileToScreen(MisoChunk *chunk, MisoCamera *camera, MisoVec2 point);
 EXPORT MisoVec2 MisoScreenToWorld(MisoCamera *camera, MisoVec2 point);
 EXPORT MisoVec2 MisoWorldToScreen(MisoCamera *camera, MisoVec2 point);
+EXPORT void MisoUpdateCamera(MisoCamera *camera);
 
 EXPORT void OrderMiso(void);
 EXPORT void OrderUp(unsigned int width, unsigned int height);